@@ -1,7 +1,9 @@
 #pragma once
 
 #include <boost/asio.hpp>
+#include <future>
 #include <shared_mutex>
+#include <vector>
 
 #include "common/functional.hpp"
 
@@ -43,6 +45,25 @@ class ThreadPool : std::enable_shared_from_this<ThreadPool> {
     return post(0, std::forward<Action>(action));
   }
 
+  // Runs task(i) for every i in [0, count) on the pool and waits for all of them. Tasks may reference local state of
+  // the caller, so all of them are finished before the first exception thrown by a task is rethrown
+  template <typename Task>
+  void parallel_for(size_t count, Task &&task) {
+    std::vector<std::future<void>> done;
+    done.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      auto packaged = std::make_shared<std::packaged_task<void()>>([&task, i] { task(i); });
+      done.emplace_back(packaged->get_future());
+      post([packaged] { (*packaged)(); });
+    }
+    for (auto &f : done) {
+      f.wait();
+    }
+    for (auto &f : done) {
+      f.get();
+    }
+  }
+
   struct Periodicity {
     uint64_t period_ms = 0, delay_ms = period_ms;
   };
@@ -3,24 +3,13 @@
 #include "common/config_exception.hpp"
 #include "common/util.hpp"
 #include "common/vrf_wrapper.hpp"
+#include "config/db_config.hpp"
 #include "config/genesis.hpp"
 #include "config/network.hpp"
 #include "logger/logger_config.hpp"
 
 namespace taraxa {
 
-struct DBConfig {
-  uint32_t db_snapshot_each_n_pbft_block = 0;
-  uint32_t db_max_snapshots = 0;
-  uint32_t db_max_open_files = 0;
-  PbftPeriod db_revert_to_period = 0;
-  bool rebuild_db = false;
-  PbftPeriod rebuild_db_period = 0;
-  bool rebuild_db_columns = false;
-};
-
-void dec_json(Json::Value const &json, DBConfig &db_config);
-
 struct FullNodeConfig {
   static constexpr uint64_t kDefaultLightNodeHistoryDays = 7;
 
@@ -53,6 +42,8 @@ struct FullNodeConfig {
   uint32_t max_levels_per_period = kMaxLevelsPerPeriod;  // For unit tests only
   bool enable_test_rpc = false;
   uint32_t final_chain_cache_in_blocks = 5;
+  // Max memory in MB used by all the final chain caches together
+  uint32_t final_chain_cache_size = 128;
 
   // config values that limits transactions pool
   uint32_t transactions_pool_size = kDefaultTransactionPoolSize;
@@ -17,7 +17,8 @@ std::string getConfigDataAsString(const Json::Value &root, const std::vector<std
 uint32_t getConfigDataAsUInt(const Json::Value &root, const std::vector<std::string> &path, bool optional = false,
                              uint32_t value = 0);
 
-uint64_t getConfigDataAsUInt64(const Json::Value &root, const std::vector<std::string> &path);
+uint64_t getConfigDataAsUInt64(const Json::Value &root, const std::vector<std::string> &path, bool optional = false,
+                               uint64_t value = 0);
 
 bool getConfigDataAsBoolean(const Json::Value &root, const std::vector<std::string> &path, bool optional = false,
                             bool value = false);
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <json/json.h>
+
+#include <map>
+#include <string>
+
+#include "common/types.hpp"
+
+namespace taraxa {
+
+/**
+ * @brief Rocksdb tuning of all column families that use the same profile
+ */
+struct DbColumnProfileConfig {
+  static constexpr auto kNoCompression = "none";
+  static constexpr auto kLZ4Compression = "lz4";
+  static constexpr auto kZSTDCompression = "zstd";
+
+  // Percentage of DbColumnsConfig::block_cache_size dedicated to columns of this profile, 0 = rocksdb default cache
+  uint32_t block_cache_share = 0;
+  // Bits per key of the bloom filter, 0 = no filter
+  uint32_t bloom_bits_per_key = 0;
+  std::string compression = kLZ4Compression;
+  // Length of the fixed key prefix used by prefix bloom filters and prefix seeks, 0 = no prefix extractor
+  uint32_t prefix_length = 0;
+  // Memtable size in MB, 0 = rocksdb default
+  uint32_t write_buffer_size = 0;
+  // Data block size in KB, 0 = rocksdb default
+  uint32_t block_size = 0;
+
+  void validate() const;
+};
+
+void dec_json(const Json::Value &json, DbColumnProfileConfig &config);
+
+struct DbColumnsConfig {
+  static constexpr auto kDefaultProfile = "default";
+  // Columns with hash keys that are mostly accessed by point lookups
+  static constexpr auto kPointLookupProfile = "point_lookup";
+  // Columns with ordered keys that are mostly read sequentially
+  static constexpr auto kSequentialProfile = "sequential";
+  // Columns keyed by (period, position) that are read by period prefix
+  static constexpr auto kPeriodEntriesProfile = "period_entries";
+
+  static std::map<std::string, DbColumnProfileConfig> defaultProfiles();
+
+  // Size of the block cache in MB that is split between profiles according to their block_cache_share
+  uint32_t block_cache_size = 512;
+  std::map<std::string, DbColumnProfileConfig> profiles = defaultProfiles();
+  // Overrides profile of specific columns, column name -> profile name
+  std::map<std::string, std::string> column_profiles;
+
+  void validate() const;
+};
+
+void dec_json(const Json::Value &json, DbColumnsConfig &config);
+
+struct DBConfig {
+  uint32_t db_snapshot_each_n_pbft_block = 0;
+  uint32_t db_max_snapshots = 0;
+  uint32_t db_max_open_files = 0;
+  PbftPeriod db_revert_to_period = 0;
+  bool rebuild_db = false;
+  PbftPeriod rebuild_db_period = 0;
+  bool rebuild_db_columns = false;
+  // Max I/O in MB per second used by background deletion of history on light node
+  uint32_t history_pruning_rate_limit = 16;
+  // Time in microseconds the group commit writer waits for more sync batches to commit them with a single WAL sync
+  uint32_t group_commit_window = 200;
+  DbColumnsConfig columns;
+
+  void validate() const;
+};
+
+void dec_json(Json::Value const &json, DBConfig &db_config);
+
+}  // namespace taraxa
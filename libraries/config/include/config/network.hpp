@@ -22,6 +22,28 @@ struct ConnectionConfig {
   // Number of threads dedicated to the rpc calls processing, default = 5
   uint16_t threads_num{5};
 
+  // Persistent http connections settings
+  uint32_t http_idle_timeout = 30;  // seconds
+  uint32_t http_max_requests_per_connection = 1000;
+  uint32_t http_max_connections = 1000;
+
+  // eth_getLogs limits, 0 = unlimited. Unlimited by default, so existing clients querying big ranges keep working
+  uint64_t logs_max_block_range = 0;
+  uint64_t logs_max_results = 0;
+  // Number of threads evaluating eth_getLogs queries
+  uint32_t logs_query_threads = 4;
+
+  static constexpr auto kWsDropOldest = "drop_oldest";
+  static constexpr auto kWsCoalesce = "coalesce";
+  static constexpr auto kWsDisconnect = "disconnect";
+  // Limits of messages queued for sending to a single websocket session, 0 = unlimited
+  uint32_t ws_max_queue_messages = 1000;
+  uint64_t ws_max_queue_bytes = 16 * 1024 * 1024;
+  // What happens with session that exceeds the limits: drop_oldest, coalesce or disconnect
+  std::string ws_slow_consumer_policy = kWsDropOldest;
+  // Max number of logs subscriptions of a single websocket session, 0 = unlimited
+  uint32_t ws_max_logs_subscriptions = 100;
+
   void validate() const;
 };
 
@@ -48,6 +70,10 @@ struct NetworkConfig {
   bool collect_packets_stats = false;
   uint16_t num_threads = std::max(uint(1), uint(std::thread::hardware_concurrency() / 2));
   uint16_t packets_processing_threads = 14;
+  // Number of threads dedicated to the transactions senders recovery in incoming transaction packets
+  uint16_t transactions_verification_threads = std::max(uint(1), uint(std::thread::hardware_concurrency() / 2));
+  // Number of threads dedicated to the VDF/VRF verification of incoming dag blocks
+  uint16_t dag_blocks_verification_threads = std::max(uint(1), uint(std::thread::hardware_concurrency() / 2));
   uint16_t peer_blacklist_timeout = kBlacklistTimeoutDefaultInSeconds;
   bool disable_peer_blacklist = false;
   uint16_t deep_syncing_threshold = 10;
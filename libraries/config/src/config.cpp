@@ -9,20 +9,13 @@
 
 namespace taraxa {
 
-void dec_json(Json::Value const &json, DBConfig &db_config) {
-  db_config.db_snapshot_each_n_pbft_block =
-      getConfigDataAsUInt(json, {"db_snapshot_each_n_pbft_block"}, true, db_config.db_snapshot_each_n_pbft_block);
-
-  db_config.db_max_snapshots = getConfigDataAsUInt(json, {"db_max_snapshots"}, true, db_config.db_max_snapshots);
-  db_config.db_max_open_files = getConfigDataAsUInt(json, {"db_max_open_files"}, true, db_config.db_max_open_files);
-}
-
 void FullNodeConfig::overwriteConfigFromJson(const Json::Value &root) {
   data_path = getConfigDataAsString(root, {"data_path"});
   db_path = data_path / "db";
 
   final_chain_cache_in_blocks =
       getConfigDataAsUInt(root, {"final_chain_cache_in_blocks"}, true, final_chain_cache_in_blocks);
+  final_chain_cache_size = getConfigDataAsUInt(root, {"final_chain_cache_size"}, true, final_chain_cache_size);
 
   // config values that limits transactions and blocks memory pools
   transactions_pool_size = getConfigDataAsUInt(root, {"transactions_pool_size"}, true, kDefaultTransactionPoolSize);
@@ -150,6 +143,7 @@ FullNodeConfig::FullNodeConfig(const Json::Value &string_or_object, const Json::
 void FullNodeConfig::validate() const {
   network.validate();
   genesis.validate();
+  db_config.validate();
   if (network.vote_accepting_periods > genesis.state.dpos.delegation_delay) {
     throw ConfigException(
         std::string("network.vote_accepting_periods(" + std::to_string(network.vote_accepting_periods) +
@@ -159,6 +153,9 @@ void FullNodeConfig::validate() const {
     throw ConfigException("transactions_pool_size cannot be smaller than " + std::to_string(kMinTransactionPoolSize) +
                           ".");
   }
+  if (!final_chain_cache_size) {
+    throw ConfigException("final_chain_cache_size must be greater than 0");
+  }
 
   // TODO: add validation of other config values
 }
@@ -53,10 +53,19 @@ uint32_t getConfigDataAsUInt(const Json::Value &root, const std::vector<std::str
   }
 }
 
-uint64_t getConfigDataAsUInt64(const Json::Value &root, const std::vector<std::string> &path) {
+uint64_t getConfigDataAsUInt64(const Json::Value &root, const std::vector<std::string> &path, bool optional,
+                               uint64_t value) {
   try {
-    return getConfigData(root, path).asUInt64();
+    Json::Value ret = getConfigData(root, path, optional);
+    if (ret.isNull()) {
+      return value;
+    } else {
+      return ret.asUInt64();
+    }
   } catch (Json::Exception &e) {
+    if (optional) {
+      return value;
+    }
     throw ConfigException(getConfigErr(path) + e.what());
   }
 }
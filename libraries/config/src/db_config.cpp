@@ -0,0 +1,110 @@
+#include "config/db_config.hpp"
+
+#include "config/config_utils.hpp"
+
+namespace taraxa {
+
+void DbColumnProfileConfig::validate() const {
+  if (compression != kNoCompression && compression != kLZ4Compression && compression != kZSTDCompression) {
+    throw ConfigException("Unsupported column compression " + compression + ", supported are: " + kNoCompression +
+                          ", " + kLZ4Compression + ", " + kZSTDCompression);
+  }
+  if (block_cache_share > 100) {
+    throw ConfigException("block_cache_share is a percentage and must be <= 100");
+  }
+}
+
+void dec_json(const Json::Value &json, DbColumnProfileConfig &config) {
+  config.block_cache_share = getConfigDataAsUInt(json, {"block_cache_share"}, true, config.block_cache_share);
+  config.bloom_bits_per_key = getConfigDataAsUInt(json, {"bloom_bits_per_key"}, true, config.bloom_bits_per_key);
+  config.compression = getConfigDataAsString(json, {"compression"}, true, config.compression);
+  config.prefix_length = getConfigDataAsUInt(json, {"prefix_length"}, true, config.prefix_length);
+  config.write_buffer_size = getConfigDataAsUInt(json, {"write_buffer_size"}, true, config.write_buffer_size);
+  config.block_size = getConfigDataAsUInt(json, {"block_size"}, true, config.block_size);
+}
+
+std::map<std::string, DbColumnProfileConfig> DbColumnsConfig::defaultProfiles() {
+  std::map<std::string, DbColumnProfileConfig> profiles;
+
+  auto &default_profile = profiles[kDefaultProfile];
+  default_profile.block_cache_share = 20;
+
+  auto &point_lookup = profiles[kPointLookupProfile];
+  point_lookup.block_cache_share = 50;
+  point_lookup.bloom_bits_per_key = 10;
+  point_lookup.block_size = 4;
+
+  auto &sequential = profiles[kSequentialProfile];
+  sequential.block_cache_share = 15;
+  sequential.compression = DbColumnProfileConfig::kZSTDCompression;
+  sequential.write_buffer_size = 128;
+  sequential.block_size = 32;
+
+  // Keys are big endian period followed by position, so the period is the prefix
+  auto &period_entries = profiles[kPeriodEntriesProfile];
+  period_entries.block_cache_share = 15;
+  period_entries.bloom_bits_per_key = 10;
+  period_entries.compression = DbColumnProfileConfig::kZSTDCompression;
+  period_entries.prefix_length = sizeof(PbftPeriod);
+  period_entries.write_buffer_size = 128;
+  period_entries.block_size = 32;
+
+  return profiles;
+}
+
+void DbColumnsConfig::validate() const {
+  uint32_t total_share = 0;
+  for (const auto &[name, profile] : profiles) {
+    profile.validate();
+    total_share += profile.block_cache_share;
+  }
+  if (total_share > 100) {
+    throw ConfigException("Sum of block_cache_share of all column profiles must be <= 100, it is " +
+                          std::to_string(total_share));
+  }
+  for (const auto &[column, profile] : column_profiles) {
+    if (!profiles.count(profile)) {
+      throw ConfigException("Column " + column + " uses unknown profile " + profile);
+    }
+  }
+}
+
+void dec_json(const Json::Value &json, DbColumnsConfig &config) {
+  config.block_cache_size = getConfigDataAsUInt(json, {"block_cache_size"}, true, config.block_cache_size);
+
+  // Configured profiles are merged into the default ones, so only the values that differ need to be specified
+  const auto &profiles_json = json["profiles"];
+  for (const auto &name : profiles_json.getMemberNames()) {
+    dec_json(profiles_json[name], config.profiles[name]);
+  }
+
+  const auto &column_profiles_json = json["column_profiles"];
+  for (const auto &column : column_profiles_json.getMemberNames()) {
+    config.column_profiles[column] = column_profiles_json[column].asString();
+  }
+}
+
+void DBConfig::validate() const {
+  if (!history_pruning_rate_limit) {
+    throw ConfigException("history_pruning_rate_limit must be greater than 0");
+  }
+  columns.validate();
+}
+
+void dec_json(Json::Value const &json, DBConfig &db_config) {
+  db_config.db_snapshot_each_n_pbft_block =
+      getConfigDataAsUInt(json, {"db_snapshot_each_n_pbft_block"}, true, db_config.db_snapshot_each_n_pbft_block);
+
+  db_config.db_max_snapshots = getConfigDataAsUInt(json, {"db_max_snapshots"}, true, db_config.db_max_snapshots);
+  db_config.db_max_open_files = getConfigDataAsUInt(json, {"db_max_open_files"}, true, db_config.db_max_open_files);
+  db_config.history_pruning_rate_limit =
+      getConfigDataAsUInt(json, {"history_pruning_rate_limit"}, true, db_config.history_pruning_rate_limit);
+  db_config.group_commit_window =
+      getConfigDataAsUInt(json, {"group_commit_window"}, true, db_config.group_commit_window);
+
+  if (const auto &columns = json["columns"]; !columns.isNull()) {
+    dec_json(columns, db_config.columns);
+  }
+}
+
+}  // namespace taraxa
@@ -19,6 +19,21 @@ void ConnectionConfig::validate() const {
   if (threads_num <= 0 || threads_num > MAX_RPC_THREADS_NUM) {
     throw ConfigException(std::string("threads_num must be in range (0, ") + std::to_string(MAX_RPC_THREADS_NUM) + "]");
   }
+
+  if (!http_idle_timeout || !http_max_requests_per_connection || !http_max_connections) {
+    throw ConfigException(
+        "http_idle_timeout, http_max_requests_per_connection and http_max_connections must be greater than 0");
+  }
+
+  if (!logs_query_threads) {
+    throw ConfigException("logs_query_threads must be greater than 0");
+  }
+
+  if (ws_slow_consumer_policy != kWsDropOldest && ws_slow_consumer_policy != kWsCoalesce &&
+      ws_slow_consumer_policy != kWsDisconnect) {
+    throw ConfigException("Unsupported ws_slow_consumer_policy " + ws_slow_consumer_policy +
+                          ", supported are: " + kWsDropOldest + ", " + kWsCoalesce + ", " + kWsDisconnect);
+  }
 }
 
 void dec_json(const Json::Value &json, ConnectionConfig &config) {
@@ -36,6 +51,23 @@ void dec_json(const Json::Value &json, ConnectionConfig &config) {
   if (auto threads_num = getConfigData(json, {"threads_num"}, true); !threads_num.isNull()) {
     config.threads_num = threads_num.asUInt();
   }
+
+  config.http_idle_timeout = getConfigDataAsUInt(json, {"http_idle_timeout"}, true, config.http_idle_timeout);
+  config.http_max_requests_per_connection = getConfigDataAsUInt(json, {"http_max_requests_per_connection"}, true,
+                                                                config.http_max_requests_per_connection);
+  config.http_max_connections =
+      getConfigDataAsUInt(json, {"http_max_connections"}, true, config.http_max_connections);
+  config.logs_max_block_range =
+      getConfigDataAsUInt64(json, {"logs_max_block_range"}, true, config.logs_max_block_range);
+  config.logs_max_results = getConfigDataAsUInt64(json, {"logs_max_results"}, true, config.logs_max_results);
+  config.logs_query_threads = getConfigDataAsUInt(json, {"logs_query_threads"}, true, config.logs_query_threads);
+  config.ws_max_queue_messages =
+      getConfigDataAsUInt(json, {"ws_max_queue_messages"}, true, config.ws_max_queue_messages);
+  config.ws_max_queue_bytes = getConfigDataAsUInt64(json, {"ws_max_queue_bytes"}, true, config.ws_max_queue_bytes);
+  config.ws_slow_consumer_policy =
+      getConfigDataAsString(json, {"ws_slow_consumer_policy"}, true, config.ws_slow_consumer_policy);
+  config.ws_max_logs_subscriptions =
+      getConfigDataAsUInt(json, {"ws_max_logs_subscriptions"}, true, config.ws_max_logs_subscriptions);
 }
 
 void NetworkConfig::validate() const {
@@ -56,6 +88,14 @@ void NetworkConfig::validate() const {
                           std::to_string(MAX_PACKETS_PROCESSING_THREADS_NUM) + "]");
   }
 
+  if (transactions_verification_threads == 0) {
+    throw ConfigException(std::string("network.transactions_verification_threads must be greater than zero"));
+  }
+
+  if (dag_blocks_verification_threads == 0) {
+    throw ConfigException(std::string("network.dag_blocks_verification_threads must be greater than zero"));
+  }
+
   if (transaction_interval_ms == 0) {
     throw ConfigException(std::string("network.transaction_interval_ms must be greater than zero"));
   }
@@ -89,6 +129,10 @@ void dec_json(const Json::Value &json, NetworkConfig &network) {
   network.sync_level_size = getConfigDataAsUInt(json, {"sync_level_size"});
   network.collect_packets_stats = getConfigDataAsBoolean(json, {"collect_packets_stats"});
   network.packets_processing_threads = getConfigDataAsUInt(json, {"packets_processing_threads"});
+  network.transactions_verification_threads = getConfigDataAsUInt(json, {"transactions_verification_threads"}, true,
+                                                                 network.transactions_verification_threads);
+  network.dag_blocks_verification_threads = getConfigDataAsUInt(json, {"dag_blocks_verification_threads"}, true,
+                                                               network.dag_blocks_verification_threads);
   network.peer_blacklist_timeout =
       getConfigDataAsUInt(json, {"peer_blacklist_timeout"}, true, NetworkConfig::kBlacklistTimeoutDefaultInSeconds);
   network.disable_peer_blacklist = getConfigDataAsBoolean(json, {"disable_peer_blacklist"}, true, false);
@@ -1,22 +1,18 @@
 #pragma once
 
-#include <bitset>
 #include <boost/function.hpp>
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/breadth_first_search.hpp>
-#include <boost/graph/depth_first_search.hpp>
-#include <boost/graph/graph_traits.hpp>
-#include <boost/graph/graphviz.hpp>
-#include <boost/graph/labeled_graph.hpp>
-#include <boost/graph/properties.hpp>
-#include <boost/property_map/property_map.hpp>
 #include <boost/thread.hpp>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <list>
+#include <map>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "common/types.hpp"
 #include "common/util.hpp"
@@ -30,34 +26,14 @@ class DagManager;
 class Network;
 
 /**
- * @brief Thread safe. Labelled graph.
+ * @brief Labelled graph. Block hashes are interned to dense vertex ids, so traversals work with vectors indexed by id
+ *        instead of hash lookups. Not thread safe, locking is done by DagManager
  */
 class Dag {
  public:
-  // properties
-  using vertex_property_t =
-      boost::property<boost::vertex_index_t, blk_hash_t, boost::property<boost::vertex_index1_t, uint64_t>>;
-  using edge_property_t = boost::property<boost::edge_index_t, uint64_t>;
-
-  // graph def
-  using adj_list_t =
-      boost::adjacency_list<boost::setS, boost::hash_setS, boost::directedS, vertex_property_t, edge_property_t>;
-  using graph_t = boost::labeled_graph<adj_list_t, blk_hash_t, boost::hash_mapS>;
-  using vertex_t = boost::graph_traits<graph_t>::vertex_descriptor;
-  using edge_t = boost::graph_traits<graph_t>::edge_descriptor;
-  using vertex_iter_t = boost::graph_traits<graph_t>::vertex_iterator;
-  using edge_iter_t = boost::graph_traits<graph_t>::edge_iterator;
-  using vertex_adj_iter_t = boost::graph_traits<graph_t>::adjacency_iterator;
-
-  // property_map
-  using vertex_index_map_const_t = boost::property_map<graph_t, boost::vertex_index_t>::const_type;
-  using vertex_index_map_t = boost::property_map<graph_t, boost::vertex_index_t>::type;
-
-  using vertex_period_map_const_t = boost::property_map<graph_t, boost::vertex_index1_t>::const_type;
-  using vertex_period_map_t = boost::property_map<graph_t, boost::vertex_index1_t>::type;
-
-  using edge_index_map_const_t = boost::property_map<graph_t, boost::edge_index_t>::const_type;
-  using edge_index_map_t = boost::property_map<graph_t, boost::edge_index_t>::type;
+  // Dense vertex id, assigned in the order of insertion
+  using vertex_t = uint32_t;
+  static constexpr vertex_t kNullVertex = std::numeric_limits<vertex_t>::max();
 
   friend DagManager;
 
@@ -85,12 +61,42 @@ class Dag {
  protected:
   // Note: private functions does not lock
 
+  /**
+   * @return vertex id of hash or kNullVertex if there is no such vertex
+   */
+  vertex_t getVertex(blk_hash_t const &hash) const;
+
+  /**
+   * @brief Adds vertex if it does not exist yet
+   * @return vertex id of hash
+   */
+  vertex_t addVertex(blk_hash_t const &hash);
+
+  /**
+   * @brief Adds edge from -> to in case it does not exist yet
+   * @return true if edge was added
+   */
+  bool addEdge(vertex_t from, vertex_t to);
+
   // traverser API
-  bool reachable(vertex_t const &from, vertex_t const &to) const;
+  /**
+   * @brief Marks all vertices from which vertex is reachable (including vertex itself) with single reverse traversal
+   */
+  std::vector<bool> collectAncestors(vertex_t vertex) const;
 
   void collectLeafVertices(std::vector<vertex_t> &leaves) const;
 
-  graph_t graph_;
+  // hash -> vertex id
+  std::unordered_map<blk_hash_t, vertex_t> vertices_;
+  // vertex id -> hash
+  std::vector<blk_hash_t> hashes_;
+  // vertex id -> ids of vertices with an edge from this vertex (children)
+  std::vector<std::vector<vertex_t>> out_edges_;
+  // vertex id -> ids of vertices with an edge to this vertex (parents)
+  std::vector<std::vector<vertex_t>> in_edges_;
+  // vertex id -> pivot vertex id, kNullVertex if vertex has no pivot edge
+  std::vector<vertex_t> pivots_;
+  uint64_t edges_count_ = 0;
 
  protected:
   LOG_OBJECTS_DEFINE
@@ -113,47 +119,28 @@ class PivotTree : public Dag {
   PivotTree &operator=(const PivotTree &) = default;
   PivotTree &operator=(PivotTree &&) = default;
 
-  using Dag::vertex_adj_iter_t;
-  using Dag::vertex_index_map_const_t;
   using Dag::vertex_t;
 
+  /**
+   * @brief Adds vertex with pivot edge and updates subtree weights of all pivot ancestors
+   */
+  bool addVEEs(blk_hash_t const &new_vertex, blk_hash_t const &pivot, std::vector<blk_hash_t> const &tips);
+
+  /**
+   * @brief Returns ghost path from vertex, it is O(path length) as subtree weights are maintained by addVEEs
+   */
   std::vector<blk_hash_t> getGhostPath(const blk_hash_t &vertex) const;
-};
-class DagBuffer;
-class FullNode;
-class KeyManager;
 
-// for graphviz
-template <class Property1>
-class vertex_label_writer {
- public:
-  vertex_label_writer(Property1 name) : name(name) {}
-  template <class Vertex>
-  void operator()(std::ostream &out, const Vertex &v) const {
-    out << "[label=\"" << name[v].toString().substr(0, 8) << " "
-        << "\"]";
-  }
+  void clear();
 
  private:
-  Property1 name;
+  // vertex id -> number of vertices in its subtree including vertex itself
+  std::vector<size_t> subtree_weights_{1};
 };
+class DagBuffer;
+class FullNode;
+class KeyManager;
 
-template <class Property>
-class edge_label_writer {
- public:
-  explicit edge_label_writer(Property weight) : weight(weight) {}
-  template <class Edge>
-  void operator()(std::ostream &out, const Edge &e) const {
-    if (weight[e] == 0) {
-      out << "[style=\"dashed\" dir=\"back\"]";
-    } else {
-      out << "[dir=\"back\"]";
-    }
-  }
-
- private:
-  Property weight;
-};
 /** @}*/
 
 }  // namespace taraxa
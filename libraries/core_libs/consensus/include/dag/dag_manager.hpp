@@ -79,9 +79,19 @@ class DagManager : public std::enable_shared_from_this<DagManager> {
   /**
    * @brief Verifies new DAG block
    * @param blk Block to verify
+   * @param vdf_verification result of verifyBlockVdf if VDF of the block was already verified
    * @return verification result
    */
-  VerifyBlockReturnType verifyBlock(const DagBlock &blk);
+  VerifyBlockReturnType verifyBlock(const DagBlock &blk,
+                                    std::optional<VerifyBlockReturnType> vdf_verification = std::nullopt);
+
+  /**
+   * @brief Verifies VDF solution and VRF proof of DAG block. It does not depend on DAG state so it can be called
+   * concurrently for blocks of any level before they are verified with verifyBlock
+   * @param blk Block to verify
+   * @return Verified, FailedVdfVerification or AheadBlock if proposal period for the block level is not known yet
+   */
+  VerifyBlockReturnType verifyBlockVdf(const DagBlock &blk) const;
 
   /**
    * @brief Checks if block pivot and tips are in DAG
@@ -236,6 +246,17 @@ class DagManager : public std::enable_shared_from_this<DagManager> {
 
  private:
   void recoverDag();
+
+  /**
+   * @brief Verifies non-finalized block loaded from db on startup, it does not depend on DAG state so it can be called
+   * concurrently for multiple blocks
+   *
+   * @param blk block to verify
+   * @return true if block is valid
+   */
+  bool verifyRecoveredBlock(const DagBlock &blk) const;
+
+  VerifyBlockReturnType verifyBlockVdf(const DagBlock &blk, PbftPeriod propose_period) const;
   void addToDag(blk_hash_t const &hash, blk_hash_t const &pivot, std::vector<blk_hash_t> const &tips, uint64_t level,
                 bool finalized = false);
   bool validateBlockNotExpired(const std::shared_ptr<DagBlock> &dag_block,
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <iostream>
-#include <map>
+#include <list>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 
 namespace taraxa {
@@ -27,47 +31,172 @@ struct is_empty<std::vector<T>> {
 };
 }  // namespace
 
+// Approximate memory used by a cached value, values with dynamically allocated data can provide their own size function
+template <class T>
+size_t cacheValueSize(const T &) {
+  return sizeof(T);
+}
+template <class T>
+size_t cacheValueSize(const std::vector<T> &v) {
+  return sizeof(v) + v.capacity() * sizeof(T);
+}
+
+struct CacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  // Approximate memory used by the cached entries in bytes
+  uint64_t size = 0;
+  uint64_t entries = 0;
+
+  CacheStats &operator+=(const CacheStats &other) {
+    hits += other.hits;
+    misses += other.misses;
+    size += other.size;
+    entries += other.entries;
+    return *this;
+  }
+};
+
+/**
+ * @brief LRU cache of values keyed by (block, key) that is bounded by approximate memory used by its entries. Entries
+ * are split into shards by hash of their key, each with its own lock and LRU list, so concurrent lookups of different
+ * keys rarely contend.
+ */
+template <class Key, class Value>
+class ShardedLruCache {
+ public:
+  using SizeFn = std::function<size_t(const Value &)>;
+  static constexpr size_t kShardsCount = 16;
+
+  ShardedLruCache(const ShardedLruCache &) = delete;
+  ShardedLruCache(ShardedLruCache &&) = delete;
+  ShardedLruCache &operator=(const ShardedLruCache &) = delete;
+  ShardedLruCache &operator=(ShardedLruCache &&) = delete;
+
+  ShardedLruCache(size_t max_size, SizeFn &&size_fn)
+      : kShardMaxSize(std::max<size_t>(max_size / kShardsCount, 1)), size_fn_(std::move(size_fn)) {}
+
+  std::optional<Value> get(uint64_t block_num, const Key &key) {
+    auto &shard = shardOf(block_num, key);
+    std::unique_lock lock(shard.mutex);
+    auto entry = shard.index.find({block_num, key});
+    if (entry == shard.index.end()) {
+      return {};
+    }
+    shard.lru.splice(shard.lru.begin(), shard.lru, entry->second);
+    return entry->second->value;
+  }
+
+  void put(uint64_t block_num, const Key &key, const Value &value) {
+    const auto entry_size = sizeof(Entry) + kEntryOverhead + size_fn_(value);
+    auto &shard = shardOf(block_num, key);
+    std::unique_lock lock(shard.mutex);
+    if (auto entry = shard.index.find({block_num, key}); entry != shard.index.end()) {
+      shard.lru.splice(shard.lru.begin(), shard.lru, entry->second);
+      return;
+    }
+    shard.lru.emplace_front(Entry{{block_num, key}, value, entry_size});
+    shard.index.emplace(shard.lru.front().key, shard.lru.begin());
+    shard.size += entry_size;
+
+    // Last entry is always kept, even if it alone exceeds the limit
+    while (shard.size > kShardMaxSize && shard.lru.size() > 1) {
+      auto &evicted = shard.lru.back();
+      shard.size -= evicted.size;
+      shard.index.erase(evicted.key);
+      shard.lru.pop_back();
+    }
+  }
+
+  bool contains(uint64_t block_num, const Key &key) const {
+    auto &shard = shardOf(block_num, key);
+    std::unique_lock lock(shard.mutex);
+    return shard.index.contains({block_num, key});
+  }
+
+  bool containsBlock(uint64_t block_num) const {
+    for (auto &shard : shards_) {
+      std::unique_lock lock(shard.mutex);
+      for (const auto &entry : shard.lru) {
+        if (entry.key.first == block_num) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  CacheStats stats() const {
+    CacheStats stats;
+    for (auto &shard : shards_) {
+      std::unique_lock lock(shard.mutex);
+      stats.size += shard.size;
+      stats.entries += shard.lru.size();
+    }
+    return stats;
+  }
+
+ private:
+  using EntryKey = std::pair<uint64_t, Key>;
+  struct EntryKeyHash {
+    size_t operator()(const EntryKey &key) const {
+      return std::hash<Key>()(key.second) ^ (std::hash<uint64_t>()(key.first) * 0x9e3779b97f4a7c15);
+    }
+  };
+  struct Entry {
+    EntryKey key;
+    Value value;
+    size_t size = 0;
+  };
+  // Approximate size of list and index nodes of an entry
+  static constexpr size_t kEntryOverhead = 64;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    std::list<Entry> lru;
+    std::unordered_map<EntryKey, typename std::list<Entry>::iterator, EntryKeyHash> index;
+    size_t size = 0;
+  };
+
+  Shard &shardOf(uint64_t block_num, const Key &key) const {
+    return shards_[EntryKeyHash()({block_num, key}) % kShardsCount];
+  }
+
+  const size_t kShardMaxSize;
+  SizeFn size_fn_;
+  mutable std::array<Shard, kShardsCount> shards_;
+};
+
+// Default max size of a single cache in bytes
+constexpr size_t kDefaultBlockCacheMaxSize = 16 * 1024 * 1024;
+
 template <class Key, class Value>
 class MapByBlockCache {
  public:
   using GetterFn = std::function<Value(uint64_t, const Key &)>;
-  using ValueMap = std::unordered_map<Key, Value>;
-  using DataMap = std::map<uint64_t, ValueMap>;
+  using SizeFn = typename ShardedLruCache<Key, Value>::SizeFn;
 
   MapByBlockCache(const MapByBlockCache &) = delete;
   MapByBlockCache(MapByBlockCache &&) = delete;
   MapByBlockCache &operator=(const MapByBlockCache &) = delete;
   MapByBlockCache &operator=(MapByBlockCache &&) = delete;
 
-  MapByBlockCache(uint64_t blocks_to_save, GetterFn &&getter_fn)
-      : kBlocksToKeep(blocks_to_save), getter_fn_(std::move(getter_fn)) {}
+  MapByBlockCache(
+      uint64_t blocks_to_save, GetterFn &&getter_fn, size_t max_size = kDefaultBlockCacheMaxSize,
+      SizeFn &&size_fn = [](const Value &v) { return cacheValueSize(v); })
+      : kBlocksToKeep(blocks_to_save), getter_fn_(std::move(getter_fn)), cache_(max_size, std::move(size_fn)) {}
 
   void append(uint64_t block_num, const Key &key, const Value &value) const {
-    std::unique_lock lock(mutex_);
-
-    auto blk_entry = data_by_block_.find(block_num);
-    if (blk_entry == data_by_block_.end()) {
-      blk_entry = data_by_block_.emplace(block_num, ValueMap()).first;
-    }
-    blk_entry->second.emplace(key, value);
-
-    // Remove older element after we added one more
-    if (data_by_block_.size() > kBlocksToKeep) {
-      data_by_block_.erase(data_by_block_.begin());
-    }
+    cache_.put(block_num, key, value);
+    updateLastBlockNum(block_num);
   }
 
   Value get(uint64_t blk_num, const Key &key) const {
-    {
-      std::shared_lock lock(mutex_);
-      auto blk_entry = data_by_block_.find(blk_num);
-      if (blk_entry != data_by_block_.end()) {
-        auto e = blk_entry->second.find(key);
-        if (e != blk_entry->second.end()) {
-          return e->second;
-        }
-      }
+    if (auto value = cache_.get(blk_num, key)) {
+      hits_++;
+      return std::move(*value);
     }
+    misses_++;
 
     auto value = getter_fn_(blk_num, key);
     if (is_empty(value)) {
@@ -81,55 +210,71 @@ class MapByBlockCache {
     return value;
   }
 
-  uint64_t lastBlockNum() const {
-    std::shared_lock lock(mutex_);
-    if (data_by_block_.empty()) {
-      return 0;
-    }
-    return data_by_block_.rbegin()->first;
+  uint64_t lastBlockNum() const { return last_block_num_; }
+
+  CacheStats stats() const {
+    auto stats = cache_.stats();
+    stats.hits = hits_;
+    stats.misses = misses_;
+    return stats;
   }
 
  protected:
+  void updateLastBlockNum(uint64_t block_num) const {
+    auto last = last_block_num_.load();
+    while (block_num > last && !last_block_num_.compare_exchange_weak(last, block_num)) {
+    }
+  }
+
   const uint64_t kBlocksToKeep;
   GetterFn getter_fn_;
 
   // cache is used from const methods in other class, so should be mutable
-  mutable std::shared_mutex mutex_;
-  mutable DataMap data_by_block_;
+  mutable ShardedLruCache<Key, Value> cache_;
+  mutable std::atomic<uint64_t> last_block_num_ = 0;
+  mutable std::atomic<uint64_t> hits_ = 0;
+  mutable std::atomic<uint64_t> misses_ = 0;
 };
 
 template <class Value>
 class ValueByBlockCache {
  public:
   using GetterFn = std::function<Value(uint64_t)>;
-  using DataMap = std::map<uint64_t, Value>;
+  using SizeFn = typename ShardedLruCache<std::monostate, Value>::SizeFn;
 
   ValueByBlockCache(const ValueByBlockCache &) = delete;
   ValueByBlockCache(ValueByBlockCache &&) = delete;
   ValueByBlockCache &operator=(const ValueByBlockCache &) = delete;
   ValueByBlockCache &operator=(ValueByBlockCache &&) = delete;
 
-  ValueByBlockCache(uint64_t blocks_to_save, GetterFn &&getter_fn)
-      : kBlocksToKeep(blocks_to_save), getter_fn_(std::move(getter_fn)) {}
+  ValueByBlockCache(
+      uint64_t blocks_to_save, GetterFn &&getter_fn, size_t max_size = kDefaultBlockCacheMaxSize,
+      SizeFn &&size_fn = [](const Value &v) { return cacheValueSize(v); })
+      : kBlocksToKeep(blocks_to_save), getter_fn_(std::move(getter_fn)), cache_(max_size, std::move(size_fn)) {}
 
   void append(uint64_t block_num, Value value) const {
-    std::unique_lock lock(mutex_);
-    data_by_block_.emplace(block_num, value);
+    cache_.put(block_num, {}, value);
 
-    // Remove older element after we added one more
-    if (data_by_block_.size() > kBlocksToKeep) {
-      data_by_block_.erase(data_by_block_.begin());
+    std::unique_lock lock(last_mutex_);
+    if (!last_ || block_num >= last_->first) {
+      last_.emplace(block_num, std::move(value));
     }
   }
 
   Value get(uint64_t block_num) const {
+    // Most of the requests are for the last block, it is served without touching the LRU
     {
-      std::shared_lock lock(mutex_);
-      auto blk_entry = data_by_block_.find(block_num);
-      if (blk_entry != data_by_block_.end()) {
-        return blk_entry->second;
+      std::shared_lock lock(last_mutex_);
+      if (last_ && last_->first == block_num) {
+        hits_++;
+        return last_->second;
       }
     }
+    if (auto value = cache_.get(block_num, {})) {
+      hits_++;
+      return std::move(*value);
+    }
+    misses_++;
 
     auto value = getter_fn_(block_num);
     if (is_empty(value)) {
@@ -144,19 +289,26 @@ class ValueByBlockCache {
   }
 
   Value last() const {
-    std::shared_lock lock(mutex_);
-    if (data_by_block_.empty()) {
+    std::shared_lock lock(last_mutex_);
+    if (!last_) {
       return {};
     }
-    return data_by_block_.rbegin()->second;
+    return last_->second;
   }
 
   uint64_t lastBlockNum() const {
-    std::shared_lock lock(mutex_);
-    if (data_by_block_.empty()) {
+    std::shared_lock lock(last_mutex_);
+    if (!last_) {
       return 0;
     }
-    return data_by_block_.rbegin()->first;
+    return last_->first;
+  }
+
+  CacheStats stats() const {
+    auto stats = cache_.stats();
+    stats.hits = hits_;
+    stats.misses = misses_;
+    return stats;
   }
 
  protected:
@@ -164,8 +316,11 @@ class ValueByBlockCache {
   GetterFn getter_fn_;
 
   // cache is used from const methods in other class, so should be mutable
-  mutable std::shared_mutex mutex_;
-  mutable DataMap data_by_block_;
+  mutable ShardedLruCache<std::monostate, Value> cache_;
+  mutable std::optional<std::pair<uint64_t, Value>> last_;
+  mutable std::shared_mutex last_mutex_;
+  mutable std::atomic<uint64_t> hits_ = 0;
+  mutable std::atomic<uint64_t> misses_ = 0;
 };
 
-}  // namespace taraxa
\ No newline at end of file
+}  // namespace taraxa
@@ -6,6 +6,7 @@
 #include "common/range_view.hpp"
 #include "common/types.hpp"
 #include "config/config.hpp"
+#include "final_chain/cache.hpp"
 #include "final_chain/data.hpp"
 #include "final_chain/state_api.hpp"
 #include "storage/storage.hpp"
@@ -48,6 +49,12 @@ class FinalChain {
 
   virtual EthBlockNumber delegation_delay() const = 0;
 
+  /**
+   * @brief Hits, misses and memory usage of all the caches of the final chain together
+   * @return cache stats
+   */
+  virtual CacheStats cache_stats() const = 0;
+
   /**
    * @brief Method which finalizes a block and executes it in EVM
    *
@@ -135,6 +142,13 @@ class FinalChain {
    */
   virtual std::optional<TransactionReceipt> transaction_receipt(h256 const& _transactionHash) const = 0;
 
+  /**
+   * @brief Method to get receipts of all transactions from the block
+   * @param n block number
+   * @return receipts in order of block transactions, receipt that is not available (e.g. pruned) is std::nullopt
+   */
+  virtual std::vector<std::optional<TransactionReceipt>> block_receipts(std::optional<EthBlockNumber> n = {}) const = 0;
+
   /**
    * @brief Method to get transactions count in block
    * @param n block number
@@ -1,9 +1,23 @@
 #pragma once
 
+#include "common/thread_pool.hpp"
 #include "common/types.hpp"
 
 namespace taraxa::final_chain {
 
 h256 hash256(dev::BytesMap const& _s);
 
+// Max number of entries of a sub-trie that is hashed as a single task by orderedTrieRoot
+constexpr size_t kOrderedTrieItemsPerTask = 256;
+
+/**
+ * @brief Computes root of the ordered trie, i.e. trie keyed by rlp encoded indexes of values, which is used for
+ * transactions and receipts roots. Result is the same as of hash256 over the same entries.
+ *
+ * If pool is provided, the trie is split into independent sub-tries that are hashed in parallel and the upper nodes
+ * are then built over their hashes. Values are only referenced, so already encoded data like cached transaction rlp
+ * are not copied and must outlive the call.
+ */
+h256 orderedTrieRoot(std::vector<dev::bytesConstRef> const& values, util::ThreadPool* pool = nullptr);
+
 }  // namespace taraxa::final_chain
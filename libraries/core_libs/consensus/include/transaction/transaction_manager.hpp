@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <mutex>
+
 #include "common/event.hpp"
 #include "config/config.hpp"
 #include "final_chain/final_chain.hpp"
@@ -46,6 +50,12 @@ class FullNode;
  * Transaction transition to non-finalized block state is done with call to saveTransactionsFromDagBlock.
  * Transaction transition to finalized block state is done with call to updateFinalizedTransactionsStatus
  *
+ * Transactions memory pool is sharded by transaction sender and non-finalized transactions are sharded by transaction
+ * hash, each shard is guarded by its own mutex so that transactions insertion, DAG block saving and proposing do not
+ * serialize on a single lock. All methods lock transactions_mutex_ in shared mode, only pbft block finalization locks
+ * it in unique mode to make the finalization atomic. Only locking is sharded, size of the pool and number of non
+ * proposable transactions are limited pool wide and evicted transactions are the lowest priority ones of the whole pool.
+ *
  * Class is thread safe in general with exception of two special methods: updateFinalizedTransactionsStatus and
  * moveNonFinalizedTransactionsToTransactionsPool. See details in function descriptions.
  */
@@ -96,6 +106,15 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
    */
   void blockFinalized(EthBlockNumber block_number);
 
+  /**
+   * @brief Updates latest accounts cache used for transactions verification with the accounts touched by finalized
+   * block: transactions senders and receivers and block author. Only accounts already present in the cache are read
+   * from the state so that verification of hot senders stays in memory across periods
+   *
+   * @param result finalized block
+   */
+  void updateLatestAccounts(const final_chain::FinalizationResult &result);
+
   /**
    * @brief Inserts verified transaction to transaction pool
    *
@@ -209,23 +228,128 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
  private:
   addr_t getFullNodeAddress() const;
 
+  /**
+   * @brief Transactions memory pool shard, contains all transactions of the senders mapped to the shard
+   */
+  struct TransactionsPoolShard {
+    // Shard queue does not enforce limits, pool size is limited pool wide by TransactionManager
+    explicit TransactionsPoolShard(size_t max_size) : transactions(max_size, false) {}
+
+    mutable std::shared_mutex mutex;
+    TransactionQueue transactions;
+  };
+
+  /**
+   * @brief Non-finalized transactions shard, contains non-finalized transactions with hashes mapped to the shard
+   */
+  struct NonFinalizedTransactionsShard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<trx_hash_t, std::shared_ptr<Transaction>> transactions;
+  };
+
+  TransactionsPoolShard &getPoolShard(const addr_t &sender) const;
+  NonFinalizedTransactionsShard &getNonFinalizedShard(const trx_hash_t &hash) const;
+
+  /**
+   * @brief Gets transactions from transactions pool, each pool shard is locked only once
+   *
+   * @param hashes
+   * @return transactions on the same positions as hashes, nullptr for transactions not in the pool
+   */
+  SharedTransactions findPoolTransactions(const std::vector<trx_hash_t> &hashes) const;
+
+  /**
+   * @brief Gets up to count transactions from transactions pool sorted by priority. Accounts are never split between
+   * pool shards so merging ordered transactions of all shards by gas price gives the same ordering as a single queue
+   *
+   * @param count
+   * @return ordered transactions
+   */
+  SharedTransactions getOrderedPoolTransactions(uint64_t count) const;
+
+  /**
+   * @brief Removes transaction from transactions pool
+   *
+   * @param trx
+   * @return true if transaction was in the pool
+   */
+  bool erasePoolTransaction(const std::shared_ptr<Transaction> &trx);
+
+  /**
+   * @brief Modifies transactions pool shard and updates pool wide counters, must be called under unique shard lock
+   *
+   * @param shard
+   * @param modify function modifying the shard transactions queue
+   * @return result of modify
+   */
+  template <class Modify>
+  auto modifyPoolShard(TransactionsPoolShard &shard, Modify &&modify);
+
+  /**
+   * @brief Evicts the lowest priority transactions of the whole pool while it is over its size limit. Victims are taken
+   * from the shard with the lowest priority transaction, so eviction order is the same as of a single queue. Must be
+   * called without any pool shard lock held
+   */
+  void evictPoolTransactions();
+
+  /**
+   * @brief Gets latest state of account for transactions verification
+   *
+   * @param addr account address
+   * @param use_cache if false account is always read from the latest state and cache is updated
+   * @return account, ZeroAccount if account does not exist
+   */
+  state_api::Account getLatestAccount(const addr_t &addr, bool use_cache = true) const;
+
+  /**
+   * @brief Saves account to latest accounts cache if it is not older than the cached one
+   *
+   * @param addr account address
+   * @param block_number block number of the state account was read from
+   * @param account
+   */
+  void cacheLatestAccount(const addr_t &addr, EthBlockNumber block_number, const state_api::Account &account) const;
+
  public:
   util::Event<TransactionManager, h256> const transaction_accepted_{};
 
  private:
   const FullNodeConfig kConf;
+  static constexpr size_t kTransactionsPoolShards = 16;
+  static constexpr size_t kNonFinalizedTransactionsShards = 16;
+
   // Guards updating transaction status
   // Transactions can be in one of three states:
   // 1. In transactions pool; 2. In non-finalized Dag block 3. Executed
+  // Locked in unique mode only for pbft block finalization, all other access is synchronized by the shards mutexes
   mutable std::shared_mutex transactions_mutex_;
-  TransactionQueue transactions_pool_;
-  std::unordered_map<trx_hash_t, std::shared_ptr<Transaction>> nonfinalized_transactions_in_dag_;
+  std::vector<std::unique_ptr<TransactionsPoolShard>> transactions_pool_;
+  mutable std::array<NonFinalizedTransactionsShard, kNonFinalizedTransactionsShards> nonfinalized_transactions_in_dag_;
+  // Modified only under unique transactions_mutex_
   std::unordered_map<trx_hash_t, std::shared_ptr<Transaction>> recently_finalized_transactions_;
-  uint64_t trx_count_ = 0;
+  std::atomic<uint64_t> trx_count_ = 0;
+  // Serializes commits of concurrently saved dag block transactions with the transactions count, so the count stored
+  // by a later commit is never lower than the one stored by an earlier commit
+  std::mutex trx_count_mutex_;
+
+  // Pool wide limits and counters, shards only split the locking
+  const size_t kNonProposableTransactionsMaxSize;
+  std::atomic<size_t> pool_size_ = 0;
+  std::atomic<size_t> non_proposable_size_ = 0;
+  std::atomic<std::chrono::system_clock::time_point> transactions_overflow_time_{};
+  // Only one thread evicts transactions at a time so the pool is not shrunk more than needed
+  std::mutex eviction_mutex_;
 
   const uint64_t kDagBlockGasLimit;
   const uint64_t kEstimateGasLimit = 200000;
   const uint64_t kRecentlyFinalizedTransactionsMax = 50000;
+  const uint64_t kLatestAccountsCacheMax = 100000;
+
+  // Latest known state of transactions senders with the block number it was read from. Balance of an account can be
+  // decreased and nonce increased only by its own transactions which are always visible in finalized blocks, balance
+  // increased by a contract call is not visible so insufficient balance is always confirmed with the latest state
+  mutable std::shared_mutex latest_accounts_mutex_;
+  mutable std::unordered_map<addr_t, std::pair<EthBlockNumber, state_api::Account>> latest_accounts_;
 
   std::shared_ptr<DbStorage> db_{nullptr};
   std::shared_ptr<FinalChain> final_chain_{nullptr};
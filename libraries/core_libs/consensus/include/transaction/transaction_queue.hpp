@@ -1,5 +1,9 @@
 #pragma once
 
+#include <map>
+#include <optional>
+#include <set>
+
 #include "common/constants.hpp"
 #include "common/util.hpp"
 #include "transaction/transaction.hpp"
@@ -20,13 +24,25 @@ enum class TransactionStatus;
  * transactions. Non proposable transactions can expire if no DAG block that contains them is received within the
  * kNonProposableTransactionsPeriodExpiryLimit.
  *
- * This is NOT thread safe class. It is proteced only by transactions_mutex_
+ * This is NOT thread safe class. It is proteced only by the transactions pool shard mutex
  * in the TransactionsManager !!!
  *
  */
 class TransactionQueue {
  public:
-  TransactionQueue(size_t max_size = kMinTransactionPoolSize);
+  // Maximum number of non proposable transactions in percentage of max size
+  static constexpr size_t kNonProposableTransactionsLimitPercentage = 20;
+
+  // If transactions are dropped within last kTransactionOverflowTimeLimit seconds, dag blocks with missing transactions
+  // will not be treated as malicious
+  static constexpr std::chrono::seconds kTransactionOverflowTimeLimit{300};
+
+  /**
+   * @param max_size maximum number of transactions, lowest priority transactions are evicted above it
+   * @param limited if false, queue never evicts transactions nor rejects non proposable transactions and max_size is
+   * used only to size internal structures, limits are then enforced by the owner of the queue (sharded pool)
+   */
+  TransactionQueue(size_t max_size = kMinTransactionPoolSize, bool limited = true);
 
   /**
    * @brief insert a transaction into the queue, sorted by priority
@@ -57,8 +73,9 @@ class TransactionQueue {
   std::shared_ptr<Transaction> get(const trx_hash_t& hash) const;
 
   /**
-   * @brief returns up to the number of requested transaction sorted by priority. This call actually sorts the
-   * transaction so it is expensive and should be used only when needed
+   * @brief returns up to the number of requested transaction sorted by priority. Ordering is done by merging persistent
+   * index of accounts head transactions with next nonce transactions of already taken accounts so complexity of the call
+   * is O(count * log(count)) and it does not depend on the size of the queue
    *
    * @param count
    * @return std::vector<std::shared_ptr<Transaction>>
@@ -126,9 +143,67 @@ class TransactionQueue {
    */
   bool nonProposableTransactionsOverTheLimit() const;
 
+  /**
+   * @brief returns number of non proposable transactions
+   *
+   * @return size_t
+   */
+  size_t nonProposableTransactionsSize() const;
+
+  /**
+   * @brief returns gas price of the lowest priority transaction, which is the one evicted first
+   *
+   * @return gas price or nullopt if queue is empty
+   */
+  std::optional<val_t> lowestGasPrice() const;
+
+  /**
+   * @brief Removes the lowest priority transaction from the queue
+   *
+   * @return hash of the removed transaction or nullopt if queue is empty
+   */
+  std::optional<trx_hash_t> evictTransaction();
+
  private:
+  using NonceTransactions = std::map<val_t, std::shared_ptr<Transaction>>;
+  // Priority of transaction is defined by gas price, hash is used only to make ordering of same gas price deterministic
+  using PriorityKey = std::pair<val_t, trx_hash_t>;
+
+  /**
+   * @brief Removes account from head transactions and eviction indexes, must be called before account transactions are
+   * modified
+   *
+   * @param account
+   */
+  void unindexAccount(const addr_t& account);
+
+  /**
+   * @brief Adds account to head transactions and eviction indexes based on current account transactions, must be
+   * called after account transactions are modified
+   *
+   * @param account
+   */
+  void indexAccount(const addr_t& account);
+
+  /**
+   * @brief Removes lowest priority transactions from the queue, the last nonce transaction of the account with the
+   * lowest gas price transaction is always the last one in the ordered transactions
+   *
+   * @param count number of transactions to remove
+   */
+  void evictTransactions(size_t count);
+
   // Transactions in the queue per account ordered by nonce
-  std::unordered_map<addr_t, std::map<val_t, std::shared_ptr<Transaction>>> account_nonce_transactions_;
+  std::unordered_map<addr_t, NonceTransactions> account_nonce_transactions_;
+
+  // Gas prices of all transactions in the queue per account
+  std::unordered_map<addr_t, std::multiset<val_t>> account_gas_prices_;
+
+  // Lowest nonce transaction of each account ordered by priority, highest priority first
+  std::map<PriorityKey, std::shared_ptr<Transaction>, std::greater<PriorityKey>> head_transactions_;
+
+  // Accounts ordered by their lowest gas price transaction, used for eviction when queue reaches max size
+  std::set<std::pair<val_t, addr_t>> accounts_by_min_gas_price_;
 
   // Transactions in the queue per trx hash
   std::unordered_map<trx_hash_t, std::shared_ptr<Transaction>> queue_transactions_;
@@ -142,21 +217,17 @@ class TransactionQueue {
   // Last time transactions were dropped due to queue reaching max size
   std::chrono::system_clock::time_point transaction_overflow_time_;
 
-  // If transactions are dropped within last kTransactionOverflowTimeLimit seconds, dag blocks with missing transactions
-  // will not be treated as malicious
-  const std::chrono::seconds kTransactionOverflowTimeLimit{300};
-
   // Limit when non proposable transactions expire
   const size_t kNonProposableTransactionsPeriodExpiryLimit = 10;
 
-  // Maximum number of non proposable transactions in percentage of kMaxSize
-  const size_t kNonProposableTransactionsLimitPercentage = 20;
-
   // Maximum number of non proposable transactions
   const size_t kNonProposableTransactionsMaxSize;
 
   // Maximum size of transactions pool
   const size_t kMaxSize;
+
+  // Limits are enforced by the queue itself
+  const bool kLimited;
 };
 
 /** @}*/
@@ -26,50 +26,73 @@ Dag::Dag(blk_hash_t const &dag_genesis_block_hash, addr_t node_addr) {
   addVEEs(dag_genesis_block_hash, {}, tips);
 }
 
-uint64_t Dag::getNumVertices() const { return boost::num_vertices(graph_); }
-uint64_t Dag::getNumEdges() const { return boost::num_edges(graph_); }
+uint64_t Dag::getNumVertices() const { return hashes_.size(); }
+uint64_t Dag::getNumEdges() const { return edges_count_; }
 
-bool Dag::hasVertex(blk_hash_t const &v) const { return graph_.vertex(v) != graph_.null_vertex(); }
+bool Dag::hasVertex(blk_hash_t const &v) const { return vertices_.count(v); }
+
+Dag::vertex_t Dag::getVertex(blk_hash_t const &hash) const {
+  if (const auto it = vertices_.find(hash); it != vertices_.end()) {
+    return it->second;
+  }
+  return kNullVertex;
+}
+
+Dag::vertex_t Dag::addVertex(blk_hash_t const &hash) {
+  const auto [it, inserted] = vertices_.emplace(hash, static_cast<vertex_t>(hashes_.size()));
+  if (inserted) {
+    assert(hashes_.size() < kNullVertex);
+    hashes_.push_back(hash);
+    out_edges_.emplace_back();
+    in_edges_.emplace_back();
+    pivots_.push_back(kNullVertex);
+  }
+  return it->second;
+}
+
+bool Dag::addEdge(vertex_t from, vertex_t to) {
+  auto &edges = out_edges_[from];
+  if (std::find(edges.begin(), edges.end(), to) != edges.end()) {
+    return false;
+  }
+  edges.push_back(to);
+  in_edges_[to].push_back(from);
+  edges_count_++;
+  return true;
+}
 
 void Dag::getLeaves(std::vector<blk_hash_t> &tips) const {
-  vertex_index_map_const_t index_map = boost::get(boost::vertex_index, graph_);
   std::vector<vertex_t> leaves;
   collectLeafVertices(leaves);
   std::transform(leaves.begin(), leaves.end(), std::back_inserter(tips),
-                 [index_map](const vertex_t &leaf) { return index_map[leaf]; });
+                 [this](const vertex_t &leaf) { return hashes_[leaf]; });
 }
 
 bool Dag::addVEEs(blk_hash_t const &new_vertex, blk_hash_t const &pivot, std::vector<blk_hash_t> const &tips) {
   assert(!new_vertex.isZero());
 
   // add vertex
-  vertex_t ret = add_vertex(new_vertex, graph_);
-  boost::get(boost::vertex_index, graph_)[ret] = new_vertex;
-  // TODO do we need this?
-  // edge_index_map_t weight_map = boost::get(boost::edge_index, graph_);
+  const vertex_t ret = addVertex(new_vertex);
 
-  edge_t edge;
   bool res = true;
 
   // Note: add edges,
   // *** important
   // Add a new block, edges are pointing from pivot to new_veretx
   if (!pivot.isZero()) {
-    if (hasVertex(pivot)) {
-      std::tie(edge, res) = boost::add_edge_by_label(pivot, new_vertex, graph_);
-      // TODO do we need this?
-      // weight_map[edge] = 1;
+    if (const auto pivot_vertex = getVertex(pivot); pivot_vertex != kNullVertex) {
+      res = addEdge(pivot_vertex, ret);
       if (!res) {
         LOG(log_wr_) << "Creating pivot edge \n" << pivot << "\n-->\n" << new_vertex << " \nunsuccessful!" << std::endl;
+      } else if (pivots_[ret] == kNullVertex) {
+        pivots_[ret] = pivot_vertex;
       }
     }
   }
   bool res2 = true;
   for (auto const &e : tips) {
-    if (hasVertex(e)) {
-      std::tie(edge, res2) = boost::add_edge_by_label(e, new_vertex, graph_);
-      // TODO do we need this?
-      // weight_map[edge] = 0;
+    if (const auto tip_vertex = getVertex(e); tip_vertex != kNullVertex) {
+      res2 = addEdge(tip_vertex, ret);
       if (!res2) {
         LOG(log_wr_) << "Creating tip edge \n" << e << "\n-->\n" << new_vertex << " \nunsuccessful!" << std::endl;
       }
@@ -81,24 +104,38 @@ bool Dag::addVEEs(blk_hash_t const &new_vertex, blk_hash_t const &pivot, std::ve
 
 void Dag::drawGraph(std::string const &filename) const {
   std::ofstream outfile(filename.c_str());
-  auto index_map = boost::get(boost::vertex_index, graph_);
-  auto weight_map = boost::get(boost::edge_index, graph_);
-
-  boost::write_graphviz(outfile, graph_, vertex_label_writer(index_map), edge_label_writer(weight_map));
+  outfile << "digraph G {" << std::endl;
+  for (vertex_t v = 0; v < hashes_.size(); v++) {
+    outfile << v << "[label=\"" << hashes_[v].toString().substr(0, 8) << " \"];" << std::endl;
+  }
+  for (vertex_t v = 0; v < hashes_.size(); v++) {
+    for (const auto child : out_edges_[v]) {
+      // Tip edges are dashed
+      outfile << v << "->" << child << (pivots_[child] == v ? " [dir=\"back\"];" : " [style=\"dashed\" dir=\"back\"];")
+              << std::endl;
+    }
+  }
+  outfile << "}" << std::endl;
   std::cout << "Dot file " << filename << " generated!" << std::endl;
   std::cout << "Use \"dot -Tpdf <dot file> -o <pdf file>\" to generate pdf file" << std::endl;
 }
 
-void Dag::clear() { graph_ = graph_t(); }
+void Dag::clear() {
+  vertices_.clear();
+  hashes_.clear();
+  out_edges_.clear();
+  in_edges_.clear();
+  pivots_.clear();
+  edges_count_ = 0;
+}
 
 void Dag::collectLeafVertices(std::vector<vertex_t> &leaves) const {
   leaves.clear();
-  vertex_iter_t s, e;
   // iterator all vertex
-  for (std::tie(s, e) = boost::vertices(graph_); s != e; ++s) {
+  for (vertex_t v = 0; v < out_edges_.size(); v++) {
     // if out-degree zero, leaf node
-    if (boost::out_degree(*s, graph_) == 0) {
-      leaves.emplace_back(*s);
+    if (out_edges_[v].empty()) {
+      leaves.emplace_back(v);
     }
   }
   assert(leaves.size());
@@ -107,66 +144,69 @@ void Dag::collectLeafVertices(std::vector<vertex_t> &leaves) const {
 // only iterate through non finalized blocks
 bool Dag::computeOrder(const blk_hash_t &anchor, std::vector<blk_hash_t> &ordered_period_vertices,
                        const std::map<uint64_t, std::unordered_set<blk_hash_t>> &non_finalized_blks) {
-  vertex_t target = graph_.vertex(anchor);
+  const vertex_t target = getVertex(anchor);
 
-  if (target == graph_.null_vertex()) {
+  if (target == kNullVertex) {
     LOG(log_wr_) << "Dag::ComputeOrder cannot find vertex (anchor) " << anchor << "\n";
     return false;
   }
   ordered_period_vertices.clear();
 
-  vertex_iter_t s, e;
-  vertex_index_map_t index_map = boost::get(boost::vertex_index, graph_);  // from vertex_descriptor to hash
-  std::map<blk_hash_t, vertex_t> epfriend;                                 // this is unordered epoch
-  epfriend[index_map[target]] = target;
-
-  // Step 1: collect all epoch blks that can reach anchor
-  // Erase from recent_added_blks after mark epoch number if finalized
+  // this is unordered epoch
+  std::vector<bool> in_epoch(hashes_.size(), false);
+  std::vector<vertex_t> epfriend{target};
+  in_epoch[target] = true;
 
+  // Step 1: collect all epoch blks that can reach anchor, all of them are found by single reverse traversal from anchor
+  const auto can_reach_anchor = collectAncestors(target);
   for (auto &l : non_finalized_blks) {
     for (auto &blk : l.second) {
-      auto v = graph_.vertex(blk);
-      if (reachable(v, target)) {
-        epfriend[index_map[v]] = v;
+      const auto v = getVertex(blk);
+      if (v == kNullVertex || in_epoch[v] || !can_reach_anchor[v]) {
+        continue;
       }
+      in_epoch[v] = true;
+      epfriend.push_back(v);
     }
   }
+  // epoch blocks are iterated in order of their hashes
+  std::sort(epfriend.begin(), epfriend.end(), [this](vertex_t a, vertex_t b) { return hashes_[a] < hashes_[b]; });
+
   // Step2: compute topological order of epfriend
-  std::unordered_set<vertex_t> visited;
-  std::stack<std::pair<vertex_t, bool>> dfs;
-  vertex_adj_iter_t adj_s, adj_e;
+  std::vector<bool> visited(hashes_.size(), false);
+  std::vector<std::pair<vertex_t, bool>> dfs;
+  std::vector<vertex_t> neighbors;
 
-  for (auto const &vp : epfriend) {
-    auto const &v = vp.second;
-    if (visited.count(v)) {
+  for (auto const v : epfriend) {
+    if (visited[v]) {
       continue;
     }
-    dfs.push({v, false});
-    visited.insert(v);
+    dfs.push_back({v, false});
+    visited[v] = true;
     while (!dfs.empty()) {
-      auto cur = dfs.top();
-      dfs.pop();
+      const auto cur = dfs.back();
+      dfs.pop_back();
       if (cur.second) {
-        ordered_period_vertices.emplace_back(index_map[cur.first]);
+        ordered_period_vertices.emplace_back(hashes_[cur.first]);
         continue;
       }
-      dfs.push({cur.first, true});
-      std::vector<std::pair<blk_hash_t, vertex_t>> neighbors;
+      dfs.push_back({cur.first, true});
+      neighbors.clear();
       // iterate through neighbors
-      for (std::tie(adj_s, adj_e) = adjacenct_vertices(cur.first, graph_); adj_s != adj_e; adj_s++) {
-        if (epfriend.find(index_map[*adj_s]) == epfriend.end()) {  // not in this epoch
+      for (const auto adj : out_edges_[cur.first]) {
+        if (!in_epoch[adj]) {  // not in this epoch
           continue;
         }
-        if (visited.count(*adj_s)) {
+        if (visited[adj]) {
           continue;
         }
-        neighbors.emplace_back(std::make_pair(index_map[*adj_s], *adj_s));
-        visited.insert(*adj_s);
+        neighbors.emplace_back(adj);
+        visited[adj] = true;
       }
       // make sure iterated nodes have deterministic order
-      std::sort(neighbors.begin(), neighbors.end());
-      for (auto const &n : neighbors) {
-        dfs.push({n.second, false});
+      std::sort(neighbors.begin(), neighbors.end(), [this](vertex_t a, vertex_t b) { return hashes_[a] < hashes_[b]; });
+      for (auto const n : neighbors) {
+        dfs.push_back({n, false});
       }
     }
   }
@@ -174,96 +214,74 @@ bool Dag::computeOrder(const blk_hash_t &anchor, std::vector<blk_hash_t> &ordere
   return true;
 }
 
-// dfs
-bool Dag::reachable(vertex_t const &from, vertex_t const &to) const {
-  if (from == to) return true;
-  vertex_t current = from;
-  vertex_t target = to;
-  std::stack<vertex_t> st;
-  std::set<vertex_t> visited;
-  st.push(current);
-  visited.insert(current);
+std::vector<bool> Dag::collectAncestors(vertex_t vertex) const {
+  std::vector<bool> visited(hashes_.size(), false);
+  std::vector<vertex_t> st{vertex};
+  visited[vertex] = true;
 
   while (!st.empty()) {
-    vertex_t t = st.top();
-    st.pop();
-    vertex_adj_iter_t s, e;
-    for (std::tie(s, e) = adjacenct_vertices(t, graph_); s != e; ++s) {
-      if (visited.count(*s)) continue;
-      if (*s == target) return true;
-      visited.insert(*s);
-      st.push(*s);
+    const vertex_t t = st.back();
+    st.pop_back();
+    for (const auto parent : in_edges_[t]) {
+      if (visited[parent]) continue;
+      visited[parent] = true;
+      st.push_back(parent);
     }
   }
-  return false;
+  return visited;
+}
+
+bool PivotTree::addVEEs(blk_hash_t const &new_vertex, blk_hash_t const &pivot, std::vector<blk_hash_t> const &tips) {
+  const auto existing_vertex = getVertex(new_vertex);
+  const auto previous_pivot = existing_vertex == kNullVertex ? kNullVertex : pivots_[existing_vertex];
+
+  const auto res = Dag::addVEEs(new_vertex, pivot, tips);
+
+  // New vertices are leaves
+  subtree_weights_.resize(hashes_.size(), 1);
+
+  // Propagate weight of the new subtree to all pivot ancestors
+  const auto vertex = getVertex(new_vertex);
+  if (pivots_[vertex] != previous_pivot) {
+    const auto weight = subtree_weights_[vertex];
+    for (auto ancestor = pivots_[vertex]; ancestor != kNullVertex; ancestor = pivots_[ancestor]) {
+      subtree_weights_[ancestor] += weight;
+    }
+  }
+  return res;
 }
 
-/**
- * Iterative version
- * Steps rounds
- * 1. post order traversal
- * 2. from leave, count weight and propagate up
- * 3. collect path
- */
+void PivotTree::clear() {
+  Dag::clear();
+  subtree_weights_.clear();
+}
 
 std::vector<blk_hash_t> PivotTree::getGhostPath(const blk_hash_t &vertex) const {
-  vertex_t root = graph_.vertex(vertex);
+  vertex_t root = getVertex(vertex);
 
-  if (root == graph_.null_vertex()) {
+  if (root == kNullVertex) {
     LOG(log_wr_) << "Cannot find vertex (getGhostPath) " << vertex << std::endl;
     return {};
   }
 
   std::vector<blk_hash_t> pivot_chain;
-  std::vector<vertex_t> post_order;
-
-  // first step: post order traversal
-  std::stack<vertex_t> st;
-  st.emplace(root);
-  vertex_t cur;
-  vertex_adj_iter_t s, e;
-  while (!st.empty()) {
-    cur = st.top();
-    st.pop();
-    post_order.emplace_back(cur);
-    for (std::tie(s, e) = adjacenct_vertices(cur, graph_); s != e; s++) {
-      st.emplace(*s);
-    }
-  }
-  std::reverse(post_order.begin(), post_order.end());
-
-  // second step: compute weight based on step one
-  std::unordered_map<vertex_t, size_t> weight_map;
-  for (auto const &n : post_order) {
-    auto total_w = 0;
-    // get childrens
-    for (std::tie(s, e) = adjacenct_vertices(n, graph_); s != e; s++) {
-      if (weight_map.count(*s)) {  // bigger timestamp
-        total_w += weight_map[*s];
-      }
-    }
-    weight_map[n] = total_w + 1;
-  }
-
-  vertex_index_map_const_t index_map = boost::get(boost::vertex_index, graph_);
 
-  // third step: collect path
+  // Follow the heaviest child, weights are subtree sizes maintained incrementally by addVEEs
   while (1) {
-    pivot_chain.emplace_back(index_map[root]);
+    pivot_chain.emplace_back(hashes_[root]);
     size_t heavist = 0;
     vertex_t next = root;
 
-    for (std::tie(s, e) = adjacenct_vertices(root, graph_); s != e; s++) {
-      if (!weight_map.count(*s)) continue;  // bigger timestamp
-      size_t w = weight_map[*s];
+    for (const auto child : out_edges_[root]) {
+      const size_t w = subtree_weights_[child];
       assert(w > 0);
       if (w > heavist) {
         heavist = w;
-        next = *s;
+        next = child;
       } else if (w == heavist) {
-        if (index_map[*s] < index_map[next]) {
+        if (hashes_[child] < hashes_[next]) {
           heavist = w;
-          next = *s;
+          next = child;
         }
       }
     }
@@ -3,6 +3,7 @@
 #include <libdevcore/CommonIO.h>
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <queue>
 #include <stack>
@@ -11,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/thread_pool.hpp"
 #include "dag/dag.hpp"
 #include "key_manager/key_manager.hpp"
 #include "network/network.hpp"
@@ -471,57 +473,67 @@ void DagManager::recoverDag() {
     }
   }
 
-  for (auto &lvl : db_->getNonfinalizedDagBlocks()) {
-    for (auto &blk : lvl.second) {
-      // These are some sanity checks that difficulty is correct and block is truly non-finalized.
-      // This is only done on startup
-      auto period = db_->getDagBlockPeriod(blk.getHash());
-      if (period != nullptr) {
-        LOG(log_er_) << "Nonfinalized Dag Block actually finalized in period " << period->first;
-        break;
-      } else {
-        auto propose_period = db_->getProposalPeriodForDagLevel(blk.getLevel());
-        if (!propose_period.has_value()) {
-          LOG(log_er_) << "No propose period for dag level " << blk.getLevel() << " found";
-          assert(false);
-          break;
-        }
-
-        const auto pk = key_manager_->get(*propose_period, blk.getSender());
-        if (!pk) {
-          LOG(log_er_) << "DAG block " << blk.getHash() << " with " << blk.getLevel()
-                       << " level is missing VRF key for sender " << blk.getSender();
-          break;
-        }
-        // Verify VDF solution
-        try {
-          blk.verifyVdf(sortition_params_manager_.getSortitionParams(*propose_period),
-                        db_->getPeriodBlockHash(*propose_period), *pk);
-        } catch (vdf_sortition::VdfSortition::InvalidVdfSortition const &e) {
-          LOG(log_er_) << "DAG block " << blk.getHash() << " with " << blk.getLevel()
-                       << " level failed on VDF verification with pivot hash " << blk.getPivot() << " reason "
-                       << e.what();
+  uint64_t recovered_blocks_count = 0;
+  const auto recovery_start = std::chrono::steady_clock::now();
+  {
+    // Verification of blocks does not depend on DAG state so all blocks of a level are verified in parallel, blocks are
+    // still added to DAG in the db order
+    util::ThreadPool verification_pool(std::max(1u, std::thread::hardware_concurrency()));
+    for (auto &lvl : db_->getNonfinalizedDagBlocks()) {
+      // All verifications are finished before any block is moved
+      std::vector<char> verified(lvl.second.size());
+      verification_pool.parallel_for(lvl.second.size(),
+                                     [&](size_t i) { verified[i] = verifyRecoveredBlock(lvl.second[i]); });
+
+      for (size_t i = 0; i < lvl.second.size(); i++) {
+        if (!verified[i]) {
           break;
         }
-      }
+        auto &blk = lvl.second[i];
 
-      // In case an invalid block somehow ended in DAG db, remove it
-      auto res = pivotAndTipsAvailable(blk);
-      if (res.first) {
-        if (!addDagBlock(std::move(blk), {}, false, false).first) {
-          LOG(log_er_) << "DAG block " << blk.getHash() << " could not be added to DAG on startup, removing from db";
+        // In case an invalid block somehow ended in DAG db, remove it
+        auto res = pivotAndTipsAvailable(blk);
+        if (res.first) {
+          if (!addDagBlock(std::move(blk), {}, false, false).first) {
+            LOG(log_er_) << "DAG block " << blk.getHash() << " could not be added to DAG on startup, removing from db";
+            db_->removeDagBlock(blk.getHash());
+          }
+        } else {
+          LOG(log_er_) << "DAG block " << blk.getHash()
+                       << " could not be added to DAG on startup since it has missing tip/pivot";
           db_->removeDagBlock(blk.getHash());
         }
-      } else {
-        LOG(log_er_) << "DAG block " << blk.getHash()
-                     << " could not be added to DAG on startup since it has missing tip/pivot";
-        db_->removeDagBlock(blk.getHash());
+        recovered_blocks_count++;
       }
     }
   }
+  const std::chrono::duration<double> recovery_duration = std::chrono::steady_clock::now() - recovery_start;
+  LOG(log_nf_) << "Recovered " << recovered_blocks_count << " non-finalized DAG blocks in "
+               << recovery_duration.count() << " s ("
+               << (recovery_duration.count() > 0 ? recovered_blocks_count / recovery_duration.count() : 0)
+               << " blocks/s)";
   trx_mgr_->recoverNonfinalizedTransactions();
 }
 
+bool DagManager::verifyRecoveredBlock(const DagBlock &blk) const {
+  // These are some sanity checks that difficulty is correct and block is truly non-finalized.
+  // This is only done on startup
+  auto period = db_->getDagBlockPeriod(blk.getHash());
+  if (period != nullptr) {
+    LOG(log_er_) << "Nonfinalized Dag Block actually finalized in period " << period->first;
+    return false;
+  }
+
+  auto propose_period = db_->getProposalPeriodForDagLevel(blk.getLevel());
+  if (!propose_period.has_value()) {
+    LOG(log_er_) << "No propose period for dag level " << blk.getLevel() << " found";
+    assert(false);
+    return false;
+  }
+
+  return verifyBlockVdf(blk, *propose_period) == VerifyBlockReturnType::Verified;
+}
+
 const std::pair<PbftPeriod, std::map<uint64_t, std::unordered_set<blk_hash_t>>> DagManager::getNonFinalizedBlocks()
     const {
   SharedLock lock(mutex_);
@@ -568,7 +580,36 @@ std::pair<size_t, size_t> DagManager::getNonFinalizedBlocksSize() const {
   return {non_finalized_blks_.size(), blocks_counter};
 }
 
-DagManager::VerifyBlockReturnType DagManager::verifyBlock(const DagBlock &blk) {
+DagManager::VerifyBlockReturnType DagManager::verifyBlockVdf(const DagBlock &blk) const {
+  const auto propose_period = db_->getProposalPeriodForDagLevel(blk.getLevel());
+  if (!propose_period.has_value()) {
+    return VerifyBlockReturnType::AheadBlock;
+  }
+  return verifyBlockVdf(blk, *propose_period);
+}
+
+DagManager::VerifyBlockReturnType DagManager::verifyBlockVdf(const DagBlock &blk, PbftPeriod propose_period) const {
+  const auto pk = key_manager_->get(propose_period, blk.getSender());
+  if (!pk) {
+    LOG(log_er_) << "DAG block " << blk.getHash() << " with " << blk.getLevel()
+                 << " level is missing VRF key for sender " << blk.getSender();
+    return VerifyBlockReturnType::FailedVdfVerification;
+  }
+
+  try {
+    const auto proposal_period_hash = db_->getPeriodBlockHash(propose_period);
+    blk.verifyVdf(sortition_params_manager_.getSortitionParams(propose_period), proposal_period_hash, *pk);
+  } catch (vdf_sortition::VdfSortition::InvalidVdfSortition const &e) {
+    LOG(log_er_) << "DAG block " << blk.getHash() << " with " << blk.getLevel()
+                 << " level failed on VDF verification with pivot hash " << blk.getPivot() << " reason " << e.what();
+    LOG(log_er_) << "period from map: " << propose_period << " current: " << pbft_chain_->getPbftChainSize();
+    return VerifyBlockReturnType::FailedVdfVerification;
+  }
+  return VerifyBlockReturnType::Verified;
+}
+
+DagManager::VerifyBlockReturnType DagManager::verifyBlock(const DagBlock &blk,
+                                                          std::optional<VerifyBlockReturnType> vdf_verification) {
   const auto &block_hash = blk.getHash();
 
   // Verify tips/pivot count amd uniqueness
@@ -611,22 +652,10 @@ DagManager::VerifyBlockReturnType DagManager::verifyBlock(const DagBlock &blk) {
     return VerifyBlockReturnType::ExpiredBlock;
   }
 
-  // Verify VDF solution
-  const auto pk = key_manager_->get(*propose_period, blk.getSender());
-  if (!pk) {
-    LOG(log_er_) << "DAG block " << blk.getHash() << " with " << blk.getLevel()
-                 << " level is missing VRF key for sender " << blk.getSender();
-    return VerifyBlockReturnType::FailedVdfVerification;
-  }
-
-  try {
-    const auto proposal_period_hash = db_->getPeriodBlockHash(*propose_period);
-    blk.verifyVdf(sortition_params_manager_.getSortitionParams(*propose_period), proposal_period_hash, *pk);
-  } catch (vdf_sortition::VdfSortition::InvalidVdfSortition const &e) {
-    LOG(log_er_) << "DAG block " << block_hash << " with " << blk.getLevel()
-                 << " level failed on VDF verification with pivot hash " << blk.getPivot() << " reason " << e.what();
-    LOG(log_er_) << "period from map: " << *propose_period << " current: " << pbft_chain_->getPbftChainSize();
-    return VerifyBlockReturnType::FailedVdfVerification;
+  // Verify VDF solution, unless it was already verified
+  if (const auto vdf_verified = vdf_verification ? *vdf_verification : verifyBlockVdf(blk, *propose_period);
+      vdf_verified != VerifyBlockReturnType::Verified) {
+    return vdf_verified;
   }
 
   auto dag_block_sender = blk.getSender();
@@ -19,6 +19,8 @@ class FinalChainImpl final : public FinalChain {
 
   // It is not prepared to use more then 1 thread. Examine it if you want to change threads count
   boost::asio::thread_pool executor_thread_{1};
+  // Hashes transactions and receipts tries of big blocks in parallel
+  util::ThreadPool trie_hashing_pool_{std::max(1u, std::thread::hardware_concurrency())};
 
   std::atomic<uint64_t> num_executed_dag_blk_ = 0;
   std::atomic<uint64_t> num_executed_trx_ = 0;
@@ -30,6 +32,14 @@ class FinalChainImpl final : public FinalChain {
   }();
   EthBlockNumber delegation_delay_;
 
+  // Percentage of final_chain_cache_size used by each of the caches
+  static constexpr size_t kAccountsCacheShare = 50;
+  static constexpr size_t kTransactionsCacheShare = 20;
+  static constexpr size_t kSmallCacheShare = 5;
+  static size_t cacheSize(const FullNodeConfig& config, size_t share) {
+    return size_t(config.final_chain_cache_size) * 1024 * 1024 * share / 100;
+  }
+
   ValueByBlockCache<std::shared_ptr<const BlockHeader>> block_headers_cache_;
   ValueByBlockCache<std::optional<const h256>> block_hashes_cache_;
   ValueByBlockCache<const SharedTransactions> transactions_cache_;
@@ -40,6 +50,17 @@ class FinalChainImpl final : public FinalChain {
   MapByBlockCache<addr_t, uint64_t> dpos_vote_count_cache_;
   MapByBlockCache<addr_t, uint64_t> dpos_is_eligible_cache_;
 
+  // Chunks of the log blooms index that contain the last block, one per level. Appending a block only alters these, so
+  // they are kept in memory to avoid reading them from db for every block and to serve queries over the chain tip
+  struct BloomChunk {
+    h256 id;
+    BlocksBlooms blooms;
+  };
+  std::array<std::optional<BloomChunk>, c_bloomIndexLevels> tip_bloom_chunks_;
+  mutable std::shared_mutex tip_bloom_chunks_mutex_;
+  // Chunks altered by the block that is being appended, they replace the tip chunks once its batch is written
+  std::array<std::optional<BloomChunk>, c_bloomIndexLevels> pending_bloom_chunks_;
+
   LOG_OBJECTS_DEFINE
 
  public:
@@ -53,21 +74,40 @@ class FinalChainImpl final : public FinalChain {
                        db->stateDbStoragePath().string(),
                    }),
         block_headers_cache_(config.final_chain_cache_in_blocks,
-                             [this](uint64_t blk) { return get_block_header(blk); }),
-        block_hashes_cache_(config.final_chain_cache_in_blocks, [this](uint64_t blk) { return get_block_hash(blk); }),
-        transactions_cache_(config.final_chain_cache_in_blocks, [this](uint64_t blk) { return get_transactions(blk); }),
-        transaction_hashes_cache_(config.final_chain_cache_in_blocks,
-                                  [this](uint64_t blk) { return get_transaction_hashes(blk); }),
+                             [this](uint64_t blk) { return get_block_header(blk); },
+                             cacheSize(config, kSmallCacheShare)),
+        block_hashes_cache_(config.final_chain_cache_in_blocks, [this](uint64_t blk) { return get_block_hash(blk); },
+                            cacheSize(config, kSmallCacheShare)),
+        transactions_cache_(
+            config.final_chain_cache_in_blocks, [this](uint64_t blk) { return get_transactions(blk); },
+            cacheSize(config, kTransactionsCacheShare),
+            [](const SharedTransactions& trxs) {
+              size_t size = cacheValueSize(trxs);
+              for (const auto& trx : trxs) {
+                size += sizeof(Transaction) + trx->getData().size();
+              }
+              return size;
+            }),
+        transaction_hashes_cache_(
+            config.final_chain_cache_in_blocks, [this](uint64_t blk) { return get_transaction_hashes(blk); },
+            cacheSize(config, kSmallCacheShare),
+            [](const std::shared_ptr<const TransactionHashes>& hashes) {
+              return sizeof(TransactionHashesImpl) + (hashes ? hashes->count() * h256::size : 0);
+            }),
         accounts_cache_(config.final_chain_cache_in_blocks,
-                        [this](uint64_t blk, const addr_t& addr) { return state_api_.get_account(blk, addr); }),
+                        [this](uint64_t blk, const addr_t& addr) { return state_api_.get_account(blk, addr); },
+                        cacheSize(config, kAccountsCacheShare)),
         total_vote_count_cache_(config.final_chain_cache_in_blocks,
-                                [this](uint64_t blk) { return state_api_.dpos_eligible_total_vote_count(blk); }),
+                                [this](uint64_t blk) { return state_api_.dpos_eligible_total_vote_count(blk); },
+                                cacheSize(config, kSmallCacheShare)),
         dpos_vote_count_cache_(
             config.final_chain_cache_in_blocks,
-            [this](uint64_t blk, const addr_t& addr) { return state_api_.dpos_eligible_vote_count(blk, addr); }),
-        dpos_is_eligible_cache_(config.final_chain_cache_in_blocks, [this](uint64_t blk, const addr_t& addr) {
-          return state_api_.dpos_is_eligible(blk, addr);
-        }) {
+            [this](uint64_t blk, const addr_t& addr) { return state_api_.dpos_eligible_vote_count(blk, addr); },
+            cacheSize(config, kSmallCacheShare)),
+        dpos_is_eligible_cache_(
+            config.final_chain_cache_in_blocks,
+            [this](uint64_t blk, const addr_t& addr) { return state_api_.dpos_is_eligible(blk, addr); },
+            cacheSize(config, kSmallCacheShare)) {
     LOG_OBJECTS_CREATE("EXECUTOR");
     num_executed_dag_blk_ = db_->getStatusField(taraxa::StatusDbField::ExecutedBlkCount);
     num_executed_trx_ = db_->getStatusField(taraxa::StatusDbField::ExecutedTrxCount);
@@ -81,6 +121,7 @@ class FinalChainImpl final : public FinalChain {
 
       block_headers_cache_.append(header->number, header);
       db_->commitWriteBatch(batch, db_opts_w_);
+      commit_bloom_chunks();
     } else {
       // We need to recover latest changes as there was shutdown inside finalize function
       if (*last_blk_num != state_db_descriptor.blk_num) [[unlikely]] {
@@ -130,6 +171,18 @@ class FinalChainImpl final : public FinalChain {
 
   EthBlockNumber delegation_delay() const override { return delegation_delay_; }
 
+  CacheStats cache_stats() const override {
+    auto stats = block_headers_cache_.stats();
+    stats += block_hashes_cache_.stats();
+    stats += transactions_cache_.stats();
+    stats += transaction_hashes_cache_.stats();
+    stats += accounts_cache_.stats();
+    stats += total_vote_count_cache_.stats();
+    stats += dpos_vote_count_cache_.stats();
+    stats += dpos_is_eligible_cache_.stats();
+    return stats;
+  }
+
   std::shared_ptr<const FinalizationResult> finalize_(PeriodData&& new_blk,
                                                       std::vector<h256>&& finalized_dag_blk_hashes,
                                                       finalize_precommit_ext const& precommit_ext) {
@@ -209,7 +262,11 @@ class FinalChainImpl final : public FinalChain {
       precommit_ext(*result, batch);
     }
 
+    // Batch has to be durable before the state is committed, otherwise state could get ahead of the final chain after
+    // power loss and recovery handles only final chain being ahead of the state. Sync is done by the group commit
+    // writer, so it is shared with concurrent writers
     db_->commitWriteBatch(batch, db_opts_w_);
+    commit_bloom_chunks();
     state_api_.transition_state_commit();
 
     num_executed_dag_blk_ = num_executed_dag_blk;
@@ -240,20 +297,29 @@ class FinalChainImpl final : public FinalChain {
     blk_header.state_root = state_root;
     blk_header.gas_used = receipts.empty() ? 0 : receipts.back().cumulative_gas_used;
     blk_header.gas_limit = gas_limit;
-    dev::BytesMap trxs_trie, receipts_trie;
+    // Cached rlp of transactions is referenced by the trie directly, receipts are encoded once for both db and trie
+    std::vector<dev::bytesConstRef> trxs_rlp, receipts_rlp;
+    std::vector<bytes> receipts_encoded;
+    trxs_rlp.reserve(transactions.size());
+    receipts_rlp.reserve(transactions.size());
+    receipts_encoded.reserve(transactions.size());
     dev::RLPStream rlp_strm;
     for (size_t i(0); i < transactions.size(); ++i) {
       auto const& trx = transactions[i];
-      auto i_rlp = util::rlp_enc(rlp_strm, i);
-      trxs_trie[i_rlp] = trx->rlp();
+      trxs_rlp.emplace_back(&trx->rlp());
       auto const& receipt = receipts[i];
-      receipts_trie[i_rlp] = util::rlp_enc(rlp_strm, receipt);
-      db_->insert(batch, DB::Columns::final_chain_receipt_by_trx_hash, trx->getHash(), rlp_strm.out());
+      receipts_encoded.emplace_back(util::rlp_enc(rlp_strm, receipt));
+      receipts_rlp.emplace_back(&receipts_encoded.back());
+      db_->insert(batch, DB::Columns::final_chain_receipt_by_trx_hash, trx->getHash(), receipts_encoded.back());
       auto bloom = receipt.bloom();
       blk_header.log_bloom |= bloom;
     }
-    blk_header.transactions_root = hash256(trxs_trie);
-    blk_header.receipts_root = hash256(receipts_trie);
+    dev::RLPStream block_receipts_rlp(receipts_encoded.size());
+    for (auto const& receipt_rlp : receipts_encoded) {
+      block_receipts_rlp.appendRaw(receipt_rlp);
+    }
+    blk_header.transactions_root = orderedTrieRoot(trxs_rlp, &trie_hashing_pool_);
+    blk_header.receipts_root = orderedTrieRoot(receipts_rlp, &trie_hashing_pool_);
     rlp_strm.clear(), blk_header.ethereum_rlp(rlp_strm);
     blk_header.hash = dev::sha3(rlp_strm.out());
     db_->insert(batch, DB::Columns::final_chain_blk_by_number, blk_header.number, util::rlp_enc(rlp_strm, blk_header));
@@ -265,6 +331,7 @@ class FinalChainImpl final : public FinalChain {
       auto chunk_to_alter = block_blooms(chunk_id);
       chunk_to_alter[index % c_bloomIndexSize] |= log_bloom_for_index;
       db_->insert(batch, DB::Columns::final_chain_log_blooms_index, chunk_id, util::rlp_enc(rlp_strm, chunk_to_alter));
+      pending_bloom_chunks_[level] = BloomChunk{chunk_id, chunk_to_alter};
     }
     TransactionLocation tl{blk_header.number};
     for (auto const& trx : transactions) {
@@ -276,6 +343,7 @@ class FinalChainImpl final : public FinalChain {
                 TransactionHashesImpl::serialize_from_transactions(transactions));
     db_->insert(batch, DB::Columns::final_chain_transaction_count_by_blk_number, blk_header.number,
                 transactions.size());
+    db_->insert(batch, DB::Columns::final_chain_receipts_by_blk_number, blk_header.number, block_receipts_rlp.out());
     db_->insert(batch, DB::Columns::final_chain_blk_hash_by_number, blk_header.number, blk_header.hash);
     db_->insert(batch, DB::Columns::final_chain_blk_number_by_hash, blk_header.hash, blk_header.number);
     db_->insert(batch, DB::Columns::final_chain_meta, DBMetaKeys::LAST_NUMBER, blk_header.number);
@@ -320,6 +388,26 @@ class FinalChainImpl final : public FinalChain {
     return ret;
   }
 
+  std::vector<std::optional<TransactionReceipt>> block_receipts(std::optional<EthBlockNumber> n = {}) const override {
+    const auto blk_n = last_if_absent(n);
+    std::vector<std::optional<TransactionReceipt>> ret;
+    if (auto raw = db_->lookup(blk_n, DB::Columns::final_chain_receipts_by_blk_number); !raw.empty()) {
+      const dev::RLP rlp(raw);
+      ret.reserve(rlp.itemCount());
+      for (auto const receipt_rlp : rlp) {
+        ret.emplace_back(TransactionReceipt())->rlp(receipt_rlp);
+      }
+      return ret;
+    }
+    // Blocks that were not migrated yet, missing receipts keep their positions so they stay aligned with transactions
+    auto hashes = transaction_hashes(blk_n);
+    ret.reserve(hashes->count());
+    for (size_t i = 0; i < hashes->count(); ++i) {
+      ret.emplace_back(transaction_receipt(hashes->get(i)));
+    }
+    return ret;
+  }
+
   uint64_t transactionCount(std::optional<EthBlockNumber> n = {}) const override {
     return db_->lookup_int<uint64_t>(last_if_absent(n), DB::Columns::final_chain_transaction_count_by_blk_number)
         .value_or(0);
@@ -441,12 +529,30 @@ class FinalChainImpl final : public FinalChain {
   }
 
   BlocksBlooms block_blooms(h256 const& chunk_id) const {
+    {
+      std::shared_lock lock(tip_bloom_chunks_mutex_);
+      for (auto const& chunk : tip_bloom_chunks_) {
+        if (chunk && chunk->id == chunk_id) {
+          return chunk->blooms;
+        }
+      }
+    }
     if (auto raw = db_->lookup(chunk_id, DB::Columns::final_chain_log_blooms_index); !raw.empty()) {
       return dev::RLP(raw).toArray<LogBloom, c_bloomIndexSize>();
     }
     return {};
   }
 
+  void commit_bloom_chunks() {
+    std::unique_lock lock(tip_bloom_chunks_mutex_);
+    for (size_t level = 0; level < c_bloomIndexLevels; ++level) {
+      if (pending_bloom_chunks_[level]) {
+        tip_bloom_chunks_[level] = std::move(pending_bloom_chunks_[level]);
+        pending_bloom_chunks_[level].reset();
+      }
+    }
+  }
+
   static h256 block_blooms_chunk_id(EthBlockNumber level, EthBlockNumber index) { return h256(index * 0xff + level); }
 
   std::vector<EthBlockNumber> withBlockBloom(LogBloom const& b, EthBlockNumber from, EthBlockNumber to,
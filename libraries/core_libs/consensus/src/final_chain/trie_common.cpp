@@ -36,11 +36,15 @@ std::string hexPrefixEncode(bytes const& _hexVector, bool _leaf, int _begin = 0,
   return ret;
 }
 
-void hash256aux(HexMap const& _s, HexMap::const_iterator _begin, HexMap::const_iterator _end, unsigned _preLen,
-                RLPStream& _rlp);
+// Returns encoded reference of the sub-trie over [_begin, _end) if it was already hashed, nullptr otherwise
+template <typename Iter>
+using SubtrieLookup = std::function<bytes const*(Iter, Iter, unsigned)>;
 
-void hash256rlp(HexMap const& _s, HexMap::const_iterator _begin, HexMap::const_iterator _end, unsigned _preLen,
-                RLPStream& _rlp) {
+template <typename Iter>
+void hash256aux(Iter _begin, Iter _end, unsigned _preLen, RLPStream& _rlp, SubtrieLookup<Iter> const& _lookup);
+
+template <typename Iter>
+void hash256rlp(Iter _begin, Iter _end, unsigned _preLen, RLPStream& _rlp, SubtrieLookup<Iter> const& _lookup) {
   if (_begin == _end) {
     _rlp << "";  // NULL
   } else if (std::next(_begin) == _end) {
@@ -62,7 +66,7 @@ void hash256rlp(HexMap const& _s, HexMap::const_iterator _begin, HexMap::const_i
     if (sharedPre > _preLen) {
       // if they all have the same next nibble, we also want a pair.
       _rlp.appendList(2) << hexPrefixEncode(_begin->first, false, _preLen, (int)sharedPre);
-      hash256aux(_s, _begin, _end, (unsigned)sharedPre, _rlp);
+      hash256aux(_begin, _end, (unsigned)sharedPre, _rlp, _lookup);
     } else {
       // otherwise enumerate all 16+1 entries.
       _rlp.appendList(17);
@@ -77,7 +81,7 @@ void hash256rlp(HexMap const& _s, HexMap::const_iterator _begin, HexMap::const_i
         if (b == n) {
           _rlp << "";
         } else {
-          hash256aux(_s, b, n, _preLen + 1, _rlp);
+          hash256aux(b, n, _preLen + 1, _rlp, _lookup);
         }
         b = n;
       }
@@ -90,10 +94,16 @@ void hash256rlp(HexMap const& _s, HexMap::const_iterator _begin, HexMap::const_i
   }
 }
 
-void hash256aux(HexMap const& _s, HexMap::const_iterator _begin, HexMap::const_iterator _end, unsigned _preLen,
-                RLPStream& _rlp) {
+template <typename Iter>
+void hash256aux(Iter _begin, Iter _end, unsigned _preLen, RLPStream& _rlp, SubtrieLookup<Iter> const& _lookup) {
+  if (_lookup) {
+    if (auto subtrie = _lookup(_begin, _end, _preLen)) {
+      _rlp.appendRaw(*subtrie);
+      return;
+    }
+  }
   RLPStream rlp;
-  hash256rlp(_s, _begin, _end, _preLen, rlp);
+  hash256rlp(_begin, _end, _preLen, rlp, _lookup);
   if (rlp.out().size() < 32) {
     // RECURSIVE RLP
     _rlp.appendRaw(rlp.out());
@@ -111,7 +121,95 @@ h256 hash256(BytesMap const& _s) {
   HexMap hexMap;
   for (auto i = _s.rbegin(); i != _s.rend(); ++i) hexMap[asNibbles(bytesConstRef(&i->first))] = i->second;
   RLPStream s;
-  hash256rlp(hexMap, hexMap.cbegin(), hexMap.cend(), 0, s);
+  hash256rlp<HexMap::const_iterator>(hexMap.cbegin(), hexMap.cend(), 0, s, {});
+  return sha3(s.out());
+}
+
+using OrderedTrieEntries = std::vector<std::pair<bytes, bytesConstRef>>;
+using OrderedTrieIter = OrderedTrieEntries::const_iterator;
+
+struct Subtrie {
+  OrderedTrieIter begin, end;
+  unsigned pre_len = 0;
+  bytes encoded;
+};
+
+// Splits the trie into disjoint sub-tries of at most kOrderedTrieItemsPerTask entries following the same structure as
+// hash256rlp, so that they can be hashed independently and then referenced when the upper nodes are built
+void planSubtries(OrderedTrieIter _begin, OrderedTrieIter _end, unsigned _preLen, std::vector<Subtrie>& _subtries,
+                  bool _root = false) {
+  if (!_root && static_cast<size_t>(std::distance(_begin, _end)) <= kOrderedTrieItemsPerTask) {
+    _subtries.push_back({_begin, _end, _preLen, {}});
+    return;
+  }
+  if (std::next(_begin) == _end) {
+    return;
+  }
+  auto sharedPre = (unsigned)-1;
+  for (auto i = std::next(_begin); i != _end && sharedPre; ++i) {
+    unsigned x = std::min(sharedPre, std::min((unsigned)_begin->first.size(), (unsigned)i->first.size()));
+    unsigned shared = _preLen;
+    for (; shared < x && _begin->first[shared] == i->first[shared]; ++shared)
+      ;
+    sharedPre = std::min(shared, sharedPre);
+  }
+  if (sharedPre > _preLen) {
+    planSubtries(_begin, _end, sharedPre, _subtries);
+    return;
+  }
+  auto b = _begin;
+  if (_preLen == b->first.size()) {
+    ++b;
+  }
+  for (auto i = 0; i < 16; ++i) {
+    auto n = b;
+    for (; n != _end && n->first[_preLen] == i; ++n)
+      ;
+    if (b != n) {
+      planSubtries(b, n, _preLen + 1, _subtries);
+    }
+    b = n;
+  }
+}
+
+h256 orderedTrieRoot(std::vector<bytesConstRef> const& values, util::ThreadPool* pool) {
+  if (values.empty()) {
+    return hash256({});
+  }
+  OrderedTrieEntries entries;
+  entries.reserve(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    auto const key = rlp(i);
+    entries.emplace_back(asNibbles(bytesConstRef(&key)), values[i]);
+  }
+  std::sort(entries.begin(), entries.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+
+  RLPStream s;
+  if (!pool || values.size() <= kOrderedTrieItemsPerTask) {
+    hash256rlp<OrderedTrieIter>(entries.cbegin(), entries.cend(), 0, s, {});
+    return sha3(s.out());
+  }
+
+  std::vector<Subtrie> subtries;
+  planSubtries(entries.cbegin(), entries.cend(), 0, subtries, true);
+  pool->parallel_for(subtries.size(), [&subtries](size_t i) {
+    auto& subtrie = subtries[i];
+    RLPStream rlp;
+    hash256aux<OrderedTrieIter>(subtrie.begin, subtrie.end, subtrie.pre_len, rlp, {});
+    subtrie.encoded = rlp.out();
+  });
+
+  // Sub-tries are planned in the order of their entries, so they are found by binary search over their begin
+  SubtrieLookup<OrderedTrieIter> lookup = [&subtries](OrderedTrieIter b, OrderedTrieIter e,
+                                                      unsigned pre_len) -> bytes const* {
+    auto it = std::lower_bound(subtries.begin(), subtries.end(), b,
+                               [](Subtrie const& subtrie, OrderedTrieIter b) { return subtrie.begin < b; });
+    if (it == subtries.end() || it->begin != b || it->end != e || it->pre_len != pre_len) {
+      return nullptr;
+    }
+    return &it->encoded;
+  };
+  hash256rlp<OrderedTrieIter>(entries.cbegin(), entries.cend(), 0, s, lookup);
   return sha3(s.out());
 }
 
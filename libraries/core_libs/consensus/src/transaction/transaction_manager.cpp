@@ -1,5 +1,6 @@
 #include "transaction/transaction_manager.hpp"
 
+#include <queue>
 #include <string>
 #include <utility>
 
@@ -11,15 +12,81 @@ namespace taraxa {
 TransactionManager::TransactionManager(FullNodeConfig const &conf, std::shared_ptr<DbStorage> db,
                                        std::shared_ptr<FinalChain> final_chain, addr_t node_addr)
     : kConf(conf),
-      transactions_pool_(kConf.transactions_pool_size),
+      kNonProposableTransactionsMaxSize(kConf.transactions_pool_size *
+                                        TransactionQueue::kNonProposableTransactionsLimitPercentage / 100),
       kDagBlockGasLimit(kConf.genesis.dag.gas_limit),
       db_(std::move(db)),
       final_chain_(std::move(final_chain)) {
   LOG_OBJECTS_CREATE("TRXMGR");
-  {
-    std::unique_lock transactions_lock(transactions_mutex_);
-    trx_count_ = db_->getStatusField(taraxa::StatusDbField::TrxCount);
+  transactions_pool_.reserve(kTransactionsPoolShards);
+  for (size_t i = 0; i < kTransactionsPoolShards; i++) {
+    transactions_pool_.emplace_back(
+        std::make_unique<TransactionsPoolShard>(kConf.transactions_pool_size / kTransactionsPoolShards + 1));
   }
+  trx_count_ = db_->getStatusField(taraxa::StatusDbField::TrxCount);
+}
+
+TransactionManager::TransactionsPoolShard &TransactionManager::getPoolShard(const addr_t &sender) const {
+  return *transactions_pool_[std::hash<addr_t>()(sender) % transactions_pool_.size()];
+}
+
+TransactionManager::NonFinalizedTransactionsShard &TransactionManager::getNonFinalizedShard(
+    const trx_hash_t &hash) const {
+  return nonfinalized_transactions_in_dag_[std::hash<trx_hash_t>()(hash) % nonfinalized_transactions_in_dag_.size()];
+}
+
+template <class Modify>
+auto TransactionManager::modifyPoolShard(TransactionsPoolShard &shard, Modify &&modify) {
+  const auto size = shard.transactions.size();
+  const auto non_proposable_size = shard.transactions.nonProposableTransactionsSize();
+  auto update_counters = [&] {
+    pool_size_ += shard.transactions.size();
+    pool_size_ -= size;
+    non_proposable_size_ += shard.transactions.nonProposableTransactionsSize();
+    non_proposable_size_ -= non_proposable_size;
+  };
+  if constexpr (std::is_void_v<decltype(modify(shard.transactions))>) {
+    modify(shard.transactions);
+    update_counters();
+  } else {
+    auto result = modify(shard.transactions);
+    update_counters();
+    return result;
+  }
+}
+
+void TransactionManager::evictPoolTransactions() {
+  std::unique_lock eviction_lock(eviction_mutex_);
+  // Pool might have been already shrunk by other thread
+  const auto pool_size = pool_size_.load();
+  if (pool_size <= kConf.transactions_pool_size) {
+    return;
+  }
+  // Same as a single queue, 1% of transactions is removed when the pool is over the limit
+  const auto count = std::max<size_t>(pool_size / 100, 1);
+  size_t evicted = 0;
+  while (evicted < count) {
+    // Shard with the lowest priority transaction among heads of all the shards
+    TransactionsPoolShard *lowest_shard = nullptr;
+    std::optional<val_t> lowest_gas_price;
+    for (const auto &shard : transactions_pool_) {
+      std::shared_lock pool_lock(shard->mutex);
+      if (const auto gas_price = shard->transactions.lowestGasPrice();
+          gas_price && (!lowest_gas_price || *gas_price < *lowest_gas_price)) {
+        lowest_gas_price = gas_price;
+        lowest_shard = shard.get();
+      }
+    }
+    if (!lowest_shard) {
+      break;
+    }
+    std::unique_lock pool_lock(lowest_shard->mutex);
+    if (modifyPoolShard(*lowest_shard, [](auto &transactions) { return transactions.evictTransaction(); })) {
+      evicted++;
+    }
+  }
+  transactions_overflow_time_ = std::chrono::system_clock::now();
+  LOG(log_dg_) << "Evicted " << evicted << " transactions from full transactions pool";
 }
 
 uint64_t TransactionManager::estimateTransactionGas(std::shared_ptr<Transaction> trx,
@@ -73,7 +140,7 @@ std::pair<TransactionStatus, std::string> TransactionManager::verifyTransaction(
     return {TransactionStatus::Invalid, "gas_price too low"};
   }
 
-  const auto account = final_chain_->get_account(trx->getSender()).value_or(taraxa::state_api::ZeroAccount);
+  auto account = getLatestAccount(trx->getSender());
 
   // Ensure the transaction adheres to nonce ordering
   if (account.nonce > trx->getNonce()) {
@@ -83,14 +150,73 @@ std::pair<TransactionStatus, std::string> TransactionManager::verifyTransaction(
   // Transactor should have enough funds to cover the costs
   // cost == V + GP * GL
   if (account.balance < trx->getCost()) {
-    return {TransactionStatus::InsufficentBalance, "insufficient balance"};
+    // Cached balance might be lower than the actual one, confirm it with the latest state
+    account = getLatestAccount(trx->getSender(), false);
+    if (account.nonce > trx->getNonce()) {
+      return {TransactionStatus::LowNonce, "nonce too low"};
+    }
+    if (account.balance < trx->getCost()) {
+      return {TransactionStatus::InsufficentBalance, "insufficient balance"};
+    }
   }
 
   return {TransactionStatus::Verified, ""};
 }
 
+state_api::Account TransactionManager::getLatestAccount(const addr_t &addr, bool use_cache) const {
+  if (use_cache) {
+    std::shared_lock accounts_lock(latest_accounts_mutex_);
+    if (const auto it = latest_accounts_.find(addr); it != latest_accounts_.end()) {
+      return it->second.second;
+    }
+  }
+
+  const auto block_number = final_chain_->last_block_number();
+  auto account = final_chain_->get_account(addr, block_number).value_or(state_api::ZeroAccount);
+  cacheLatestAccount(addr, block_number, account);
+  return account;
+}
+
+void TransactionManager::cacheLatestAccount(const addr_t &addr, EthBlockNumber block_number,
+                                            const state_api::Account &account) const {
+  std::unique_lock accounts_lock(latest_accounts_mutex_);
+  auto it = latest_accounts_.find(addr);
+  if (it == latest_accounts_.end()) {
+    if (latest_accounts_.size() >= kLatestAccountsCacheMax) {
+      latest_accounts_.clear();
+    }
+    latest_accounts_.emplace(addr, std::make_pair(block_number, account));
+  } else if (it->second.first <= block_number) {
+    // Account might have been already updated from newer block while it was being read
+    it->second = {block_number, account};
+  }
+}
+
+void TransactionManager::updateLatestAccounts(const final_chain::FinalizationResult &result) {
+  const auto block_number = result.final_chain_blk->number;
+  std::unordered_set<addr_t> touched_accounts{result.author};
+  for (const auto &trx : result.trxs) {
+    touched_accounts.insert(trx->getSender());
+    if (const auto &receiver = trx->getReceiver()) {
+      touched_accounts.insert(*receiver);
+    }
+  }
+
+  for (const auto &addr : touched_accounts) {
+    {
+      std::shared_lock accounts_lock(latest_accounts_mutex_);
+      if (!latest_accounts_.contains(addr)) {
+        continue;
+      }
+    }
+    cacheLatestAccount(addr, block_number,
+                       final_chain_->get_account(addr, block_number).value_or(state_api::ZeroAccount));
+  }
+}
+
 bool TransactionManager::isTransactionKnown(const trx_hash_t &trx_hash) {
-  return transactions_pool_.isTransactionKnown(trx_hash);
+  return std::any_of(transactions_pool_.begin(), transactions_pool_.end(),
+                     [&trx_hash](const auto &shard) { return shard->transactions.isTransactionKnown(trx_hash); });
 }
 
 std::pair<bool, std::string> TransactionManager::insertTransaction(const std::shared_ptr<Transaction> &trx) {
@@ -118,38 +244,96 @@ std::pair<bool, std::string> TransactionManager::insertTransaction(const std::sh
 
 bool TransactionManager::insertValidatedTransaction(std::shared_ptr<Transaction> &&tx, const TransactionStatus status) {
   const auto trx_hash = tx->getHash();
+  auto &pool_shard = getPoolShard(tx->getSender());
 
-  // This lock synchronizes inserting and removing transactions from transactions memory pool with database insertion.
-  // It is very important to lock checking the db state of transaction together with transaction pool checking to be
-  // protected from new DAG block and Period data transactions insertions which are inserted directly in the database.
-  std::unique_lock transactions_lock(transactions_mutex_);
+  // Check the db with if transaction is really new. Db is checked without any lock, transactions which are being saved
+  // or finalized concurrently are detected by the in memory checks below
+  if (db_->transactionInDb(trx_hash)) {
+    pool_shard.transactions.markTransactionKnown(trx_hash);
+    return false;
+  }
   const auto last_block_number = final_chain_->last_block_number();
 
-  // Check the db with if transaction is really new
-  if (db_->transactionInDb(trx_hash)) {
-    transactions_pool_.markTransactionKnown(trx_hash);
+  // This lock synchronizes inserting and removing transactions from transactions memory pool with DAG block and Period
+  // data transactions insertions. DAG block and Period data transactions are always added to non-finalized or recently
+  // finalized transactions before they are removed from the pool shard, so it is very important to check them (in this
+  // order) under the same pool shard lock as inserting the transaction.
+  std::shared_lock transactions_lock(transactions_mutex_);
+  std::unique_lock pool_lock(pool_shard.mutex);
+  if (getNonFinalizedTransaction(trx_hash) || recently_finalized_transactions_.contains(trx_hash)) {
+    pool_shard.transactions.markTransactionKnown(trx_hash);
+    return false;
+  }
+
+  // Non proposable transactions are limited pool wide
+  if ((status == TransactionStatus::LowNonce || status == TransactionStatus::InsufficentBalance) &&
+      non_proposable_size_ > kNonProposableTransactionsMaxSize) {
+    transactions_overflow_time_ = std::chrono::system_clock::now();
     return false;
   }
 
   LOG(log_dg_) << "Transaction " << trx_hash << " inserted in trx pool";
-  return transactions_pool_.insert(std::move(tx), status, last_block_number);
+  if (!modifyPoolShard(pool_shard, [&](auto &transactions) {
+        return transactions.insert(std::move(tx), status, last_block_number);
+      })) {
+    return false;
+  }
+  pool_lock.unlock();
+
+  // Pool shard lock is released as eviction locks all the shards
+  if (pool_size_ > kConf.transactions_pool_size) [[unlikely]] {
+    evictPoolTransactions();
+    std::shared_lock pool_shared_lock(pool_shard.mutex);
+    return pool_shard.transactions.contains(trx_hash);
+  }
+  return true;
 }
 
-unsigned long TransactionManager::getTransactionCount() const {
-  std::shared_lock shared_transactions_lock(transactions_mutex_);
-  return trx_count_;
+unsigned long TransactionManager::getTransactionCount() const { return trx_count_; }
+
+SharedTransactions TransactionManager::findPoolTransactions(const std::vector<trx_hash_t> &hashes) const {
+  SharedTransactions result(hashes.size());
+  for (const auto &shard : transactions_pool_) {
+    std::shared_lock pool_lock(shard->mutex);
+    for (size_t i = 0; i < hashes.size(); i++) {
+      if (!result[i]) {
+        result[i] = shard->transactions.get(hashes[i]);
+      }
+    }
+  }
+  return result;
+}
+
+bool TransactionManager::erasePoolTransaction(const std::shared_ptr<Transaction> &trx) {
+  // Transactions with invalid signature are never inserted in the pool
+  try {
+    auto &pool_shard = getPoolShard(trx->getSender());
+    std::unique_lock pool_lock(pool_shard.mutex);
+    return modifyPoolShard(pool_shard, [&](auto &transactions) { return transactions.erase(trx->getHash()); });
+  } catch (const Transaction::InvalidSignature &) {
+    return false;
+  }
+}
+
+std::shared_ptr<Transaction> TransactionManager::getNonFinalizedTransaction(const trx_hash_t &hash) const {
+  const auto &shard = getNonFinalizedShard(hash);
+  std::shared_lock nonfinalized_lock(shard.mutex);
+  if (const auto it = shard.transactions.find(hash); it != shard.transactions.end()) {
+    return it->second;
+  }
+  return nullptr;
 }
 
 std::pair<std::vector<std::shared_ptr<Transaction>>, std::vector<trx_hash_t>> TransactionManager::getPoolTransactions(
     const std::vector<trx_hash_t> &trx_to_query) const {
   std::shared_lock transactions_lock(transactions_mutex_);
   std::pair<std::vector<std::shared_ptr<Transaction>>, std::vector<trx_hash_t>> result;
-  for (const auto &hash : trx_to_query) {
-    auto trx = transactions_pool_.get(hash);
-    if (trx) {
-      result.first.emplace_back(trx);
+  auto trxs = findPoolTransactions(trx_to_query);
+  for (size_t i = 0; i < trx_to_query.size(); i++) {
+    if (trxs[i]) {
+      result.first.emplace_back(std::move(trxs[i]));
     } else {
-      result.second.emplace_back(hash);
+      result.second.emplace_back(trx_to_query[i]);
     }
   }
   return result;
@@ -157,8 +341,11 @@ std::pair<std::vector<std::shared_ptr<Transaction>>, std::vector<trx_hash_t>> Tr
 
 std::shared_ptr<Transaction> TransactionManager::getTransaction(trx_hash_t const &hash) const {
   std::shared_lock transactions_lock(transactions_mutex_);
-  auto trx = transactions_pool_.get(hash);
-  if (trx) {
+  if (auto trx = findPoolTransactions({hash}).front()) {
+    return trx;
+  }
+  // Non-finalized transactions might not be committed to db yet
+  if (auto trx = getNonFinalizedTransaction(hash)) {
     return trx;
   }
   return db_->getTransaction(hash);
@@ -172,26 +359,33 @@ void TransactionManager::saveTransactionsFromDagBlock(SharedTransactions const &
   std::transform(trxs.begin(), trxs.end(), std::back_inserter(trx_hashes),
                  [](std::shared_ptr<Transaction> const &t) { return t->getHash(); });
 
+  // Db is checked before locking, transactions finalized concurrently are detected by recently finalized transactions
+  // and transactions saved concurrently by non-finalized transactions emplace
+  const auto trx_in_db = db_->transactionsInDb(trx_hashes);
   {
-    // This lock synchronizes inserting and removing transactions from transactions memory pool with database insertion.
-    // Unique lock here makes sure that transactions we are removing are not reinserted in transactions_pool_
-    std::unique_lock transactions_lock(transactions_mutex_);
+    // Shared lock only excludes pbft block finalization, concurrent transactions insertion is synchronized with the
+    // pool shards mutexes. Transactions are added to non-finalized transactions before they are removed from the pool
+    // shard which makes sure that transactions we are removing are not reinserted in transactions_pool_
+    std::shared_lock transactions_lock(transactions_mutex_);
 
-    auto trx_in_db = db_->transactionsInDb(trx_hashes);
     for (uint64_t i = 0; i < trxs.size(); i++) {
       auto const &trx_hash = trx_hashes[i];
       // We only save transaction if it has not already been saved
-      if (!trx_in_db[i]) {
-        db_->addTransactionToBatch(*trxs[i], write_batch);
-        nonfinalized_transactions_in_dag_.emplace(trx_hash, trxs[i]);
+      if (!trx_in_db[i] && !recently_finalized_transactions_.contains(trx_hash)) {
+        auto &nonfinalized_shard = getNonFinalizedShard(trx_hash);
+        std::unique_lock nonfinalized_lock(nonfinalized_shard.mutex);
+        if (nonfinalized_shard.transactions.emplace(trx_hash, trxs[i]).second) {
+          db_->addTransactionToBatch(*trxs[i], write_batch);
+        }
       }
-      if (transactions_pool_.erase(trx_hash)) {
+      if (erasePoolTransaction(trxs[i])) {
         LOG(log_dg_) << "Transaction " << trx_hash << " removed from trx pool ";
         // Transactions are counted when included in DAG
         trx_count_++;
         accepted_transactions.emplace_back(trx_hash);
       }
     }
+    std::unique_lock trx_count_lock(trx_count_mutex_);
     db_->addStatusFieldToBatch(StatusDbField::TrxCount, trx_count_, write_batch);
     db_->commitWriteBatch(write_batch);
   }
@@ -220,30 +414,30 @@ void TransactionManager::recoverNonfinalizedTransactions() {
     } else {
       // Cache sender now by caling getSender since getting sender later on proposing blocks can affect performance
       trxs[i]->getSender();
-      nonfinalized_transactions_in_dag_.emplace(trx_hash, std::move(trxs[i]));
+      getNonFinalizedShard(trx_hash).transactions.emplace(trx_hash, std::move(trxs[i]));
     }
   }
   db_->commitWriteBatch(write_batch);
 }
 
-size_t TransactionManager::getTransactionPoolSize() const {
-  std::shared_lock transactions_lock(transactions_mutex_);
-  return transactions_pool_.size();
-}
+size_t TransactionManager::getTransactionPoolSize() const { return pool_size_; }
 
 bool TransactionManager::nonProposableTransactionsOverTheLimit() const {
-  std::shared_lock transactions_lock(transactions_mutex_);
-  return transactions_pool_.nonProposableTransactionsOverTheLimit();
+  return non_proposable_size_ >= kNonProposableTransactionsMaxSize;
 }
 
 bool TransactionManager::isTransactionPoolFull(size_t precentage) const {
-  std::shared_lock transactions_lock(transactions_mutex_);
-  return transactions_pool_.size() >= (kConf.transactions_pool_size * precentage / 100);
+  return getTransactionPoolSize() >= (kConf.transactions_pool_size * precentage / 100);
 }
 
 size_t TransactionManager::getNonfinalizedTrxSize() const {
   std::shared_lock transactions_lock(transactions_mutex_);
-  return nonfinalized_transactions_in_dag_.size();
+  size_t size = 0;
+  for (const auto &shard : nonfinalized_transactions_in_dag_) {
+    std::shared_lock nonfinalized_lock(shard.mutex);
+    size += shard.transactions.size();
+  }
+  return size;
 }
 
 std::vector<std::shared_ptr<Transaction>> TransactionManager::getNonfinalizedTrx(
@@ -252,27 +446,75 @@ std::vector<std::shared_ptr<Transaction>> TransactionManager::getNonfinalizedTrx
   ret.reserve(hashes.size());
   std::shared_lock transactions_lock(transactions_mutex_);
   for (const auto &hash : hashes) {
-    if (nonfinalized_transactions_in_dag_.contains(hash)) {
-      ret.push_back(nonfinalized_transactions_in_dag_[hash]);
+    if (auto trx = getNonFinalizedTransaction(hash)) {
+      ret.push_back(std::move(trx));
     }
   }
   return ret;
 }
 
 std::vector<trx_hash_t> TransactionManager::excludeFinalizedTransactions(const std::vector<trx_hash_t> &hashes) {
-  std::vector<trx_hash_t> ret;
-  ret.reserve(hashes.size());
-  std::shared_lock transactions_lock(transactions_mutex_);
-  for (const auto &hash : hashes) {
-    if (!recently_finalized_transactions_.contains(hash)) {
-      if (!db_->transactionFinalized(hash)) {
-        ret.push_back(hash);
+  std::vector<trx_hash_t> not_recently_finalized;
+  not_recently_finalized.reserve(hashes.size());
+  {
+    std::shared_lock transactions_lock(transactions_mutex_);
+    for (const auto &hash : hashes) {
+      if (!recently_finalized_transactions_.contains(hash)) {
+        not_recently_finalized.push_back(hash);
       }
     }
   }
+  // Db is checked without lock, finalized transactions are never moved back to non-finalized state
+  const auto finalized = db_->transactionsFinalized(not_recently_finalized);
+  std::vector<trx_hash_t> ret;
+  ret.reserve(not_recently_finalized.size());
+  for (size_t i = 0; i < not_recently_finalized.size(); i++) {
+    if (!finalized[i]) {
+      ret.push_back(not_recently_finalized[i]);
+    }
+  }
   return ret;
 }
 
+SharedTransactions TransactionManager::getOrderedPoolTransactions(uint64_t count) const {
+  std::vector<SharedTransactions> shards_trxs;
+  shards_trxs.reserve(transactions_pool_.size());
+  for (const auto &shard : transactions_pool_) {
+    std::shared_lock pool_lock(shard->mutex);
+    shards_trxs.emplace_back(shard->transactions.getOrderedTransactions(count));
+  }
+
+  // Position of the next transaction in shards_trxs, next transactions are merged by gas price and hash the same way as
+  // TransactionQueue orders its head transactions
+  using ShardPosition = std::pair<size_t, size_t>;
+  const auto lower_priority = [&shards_trxs](const ShardPosition &a, const ShardPosition &b) {
+    const auto &a_trx = shards_trxs[a.first][a.second];
+    const auto &b_trx = shards_trxs[b.first][b.second];
+    if (a_trx->getGasPrice() != b_trx->getGasPrice()) {
+      return a_trx->getGasPrice() < b_trx->getGasPrice();
+    }
+    return a_trx->getHash() < b_trx->getHash();
+  };
+  std::priority_queue<ShardPosition, std::vector<ShardPosition>, decltype(lower_priority)> next_trxs(lower_priority);
+  for (size_t i = 0; i < shards_trxs.size(); i++) {
+    if (!shards_trxs[i].empty()) {
+      next_trxs.emplace(i, 0);
+    }
+  }
+
+  SharedTransactions trxs;
+  trxs.reserve(count);
+  while (trxs.size() < count && !next_trxs.empty()) {
+    const auto [shard, position] = next_trxs.top();
+    next_trxs.pop();
+    trxs.emplace_back(shards_trxs[shard][position]);
+    if (position + 1 < shards_trxs[shard].size()) {
+      next_trxs.emplace(shard, position + 1);
+    }
+  }
+  return trxs;
+}
+
 /**
  * Retrieve transactions to be included in proposed block
  */
@@ -284,7 +526,7 @@ std::pair<SharedTransactions, std::vector<uint64_t>> TransactionManager::packTrx
   const uint64_t max_transactions_in_block = weight_limit / kMinTxGas;
   {
     std::shared_lock transactions_lock(transactions_mutex_);
-    trxs = transactions_pool_.getOrderedTransactions(max_transactions_in_block);
+    trxs = getOrderedPoolTransactions(max_transactions_in_block);
   }
   for (uint64_t i = 0; i < trxs.size(); i++) {
     uint64_t weight;
@@ -301,7 +543,13 @@ std::pair<SharedTransactions, std::vector<uint64_t>> TransactionManager::packTrx
 
 SharedTransactions TransactionManager::getAllPoolTrxs() {
   std::shared_lock transactions_lock(transactions_mutex_);
-  return transactions_pool_.getAllTransactions();
+  SharedTransactions trxs;
+  for (const auto &shard : transactions_pool_) {
+    std::shared_lock pool_lock(shard->mutex);
+    auto shard_trxs = shard->transactions.getAllTransactions();
+    trxs.insert(trxs.end(), std::make_move_iterator(shard_trxs.begin()), std::make_move_iterator(shard_trxs.end()));
+  }
+  return trxs;
 }
 
 /**
@@ -314,13 +562,18 @@ void TransactionManager::updateFinalizedTransactionsStatus(PeriodData const &per
       recently_finalized_transactions_.clear();
     }
     for (auto const &trx : period_data.transactions) {
+      // Transaction must be added to recently finalized transactions before it is removed from non-finalized
+      // transactions and transactions pool, see insertValidatedTransaction
       recently_finalized_transactions_[trx->getHash()] = trx;
-      if (!nonfinalized_transactions_in_dag_.erase(trx->getHash())) {
+      auto &nonfinalized_shard = getNonFinalizedShard(trx->getHash());
+      std::unique_lock nonfinalized_lock(nonfinalized_shard.mutex);
+      if (!nonfinalized_shard.transactions.erase(trx->getHash())) {
         trx_count_++;
       } else {
         LOG(log_dg_) << "Transaction " << trx->getHash() << " removed from nonfinalized transactions";
       }
-      if (transactions_pool_.erase(trx->getHash())) {
+      nonfinalized_lock.unlock();
+      if (erasePoolTransaction(trx)) {
         LOG(log_dg_) << "Transaction " << trx->getHash() << " removed from transactions_pool_";
       }
     }
@@ -332,14 +585,26 @@ void TransactionManager::moveNonFinalizedTransactionsToTransactionsPool(std::uno
   // !!! There is no lock because it is called under std::unique_lock trx_lock(trx_mgr_->getTransactionsMutex());
   auto write_batch = db_->createWriteBatch();
   for (auto const &trx_hash : transactions) {
-    auto trx = nonfinalized_transactions_in_dag_.find(trx_hash);
-    if (trx != nonfinalized_transactions_in_dag_.end()) {
-      db_->removeTransactionToBatch(trx_hash, write_batch);
-      transactions_pool_.insert(std::move(trx->second), TransactionStatus::Verified);
-      nonfinalized_transactions_in_dag_.erase(trx);
+    std::shared_ptr<Transaction> trx;
+    {
+      auto &nonfinalized_shard = getNonFinalizedShard(trx_hash);
+      std::unique_lock nonfinalized_lock(nonfinalized_shard.mutex);
+      auto trx_it = nonfinalized_shard.transactions.find(trx_hash);
+      if (trx_it == nonfinalized_shard.transactions.end()) {
+        continue;
+      }
+      trx = std::move(trx_it->second);
+      nonfinalized_shard.transactions.erase(trx_it);
     }
+    db_->removeTransactionToBatch(trx_hash, write_batch);
+    auto &pool_shard = getPoolShard(trx->getSender());
+    std::unique_lock pool_lock(pool_shard.mutex);
+    modifyPoolShard(pool_shard, [&](auto &transactions) {
+      return transactions.insert(std::move(trx), TransactionStatus::Verified);
+    });
   }
   db_->commitWriteBatch(write_batch);
+  evictPoolTransactions();
 }
 
 // Verify all block transactions are present
@@ -355,21 +620,19 @@ std::optional<SharedTransactions> TransactionManager::getBlockTransactions(DagBl
   transactions.reserve(all_block_trx_hashes.size());
   {
     std::shared_lock transactions_lock(transactions_mutex_);
-    for (auto const &tx_hash : all_block_trx_hashes) {
-      auto trx = transactions_pool_.get(tx_hash);
-      if (trx != nullptr) {
+    auto pool_trxs = findPoolTransactions(all_block_trx_hashes);
+    for (size_t i = 0; i < all_block_trx_hashes.size(); i++) {
+      auto const &tx_hash = all_block_trx_hashes[i];
+      if (pool_trxs[i] != nullptr) {
+        transactions.emplace_back(std::move(pool_trxs[i]));
+      } else if (auto trx = getNonFinalizedTransaction(tx_hash)) {
         transactions.emplace_back(std::move(trx));
       } else {
-        auto trx_it = nonfinalized_transactions_in_dag_.find(tx_hash);
-        if (trx_it != nonfinalized_transactions_in_dag_.end()) {
+        auto trx_it = recently_finalized_transactions_.find(tx_hash);
+        if (trx_it != recently_finalized_transactions_.end()) {
           transactions.emplace_back(trx_it->second);
         } else {
-          trx_it = recently_finalized_transactions_.find(tx_hash);
-          if (trx_it != recently_finalized_transactions_.end()) {
-            transactions.emplace_back(trx_it->second);
-          } else {
-            finalized_trx_hashes.emplace_back(tx_hash);
-          }
+          finalized_trx_hashes.emplace_back(tx_hash);
         }
       }
     }
@@ -388,13 +651,16 @@ std::optional<SharedTransactions> TransactionManager::getBlockTransactions(DagBl
 }
 
 void TransactionManager::blockFinalized(EthBlockNumber block_number) {
-  std::unique_lock transactions_lock(transactions_mutex_);
-  transactions_pool_.blockFinalized(block_number);
+  std::shared_lock transactions_lock(transactions_mutex_);
+  for (const auto &shard : transactions_pool_) {
+    std::unique_lock pool_lock(shard->mutex);
+    modifyPoolShard(*shard, [&](auto &transactions) { transactions.blockFinalized(block_number); });
+  }
 }
 
 bool TransactionManager::transactionsDropped() const {
-  std::shared_lock transactions_lock(transactions_mutex_);
-  return transactions_pool_.transactionsDropped();
+  return std::chrono::system_clock::now() - transactions_overflow_time_.load() <
+         TransactionQueue::kTransactionOverflowTimeLimit;
 }
 
 }  // namespace taraxa
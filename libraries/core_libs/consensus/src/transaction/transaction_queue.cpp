@@ -4,10 +4,11 @@
 
 namespace taraxa {
 
-TransactionQueue::TransactionQueue(size_t max_size)
+TransactionQueue::TransactionQueue(size_t max_size, bool limited)
     : known_txs_(max_size * 2, max_size / 5),
       kNonProposableTransactionsMaxSize(max_size * kNonProposableTransactionsLimitPercentage / 100),
-      kMaxSize(max_size) {
+      kMaxSize(max_size),
+      kLimited(limited) {
   queue_transactions_.reserve(max_size);
 }
 
@@ -32,37 +33,40 @@ std::shared_ptr<Transaction> TransactionQueue::get(const trx_hash_t &hash) const
 
 SharedTransactions TransactionQueue::getOrderedTransactions(uint64_t count) const {
   SharedTransactions ret;
-  ret.reserve(count);
-
-  std::multimap<val_t, std::shared_ptr<Transaction>, std::greater<val_t>> head_transactions;
-  std::unordered_map<addr_t, std::pair<std::map<val_t, std::shared_ptr<Transaction>>::const_iterator,
-                                       std::map<val_t, std::shared_ptr<Transaction>>::const_iterator>>
-      iterators;
-
-  iterators.reserve(account_nonce_transactions_.size());
-  // For accounts with multiple transactions we will iterate one level at a time
-  for (const auto &account : account_nonce_transactions_) {
-    iterators.insert({account.first, {account.second.begin(), account.second.end()}});
-  }
-
-  for (auto it = iterators.begin(); it != iterators.end(); it++) {
-    head_transactions.insert({it->second.first->second->getGasPrice(), it->second.first->second});
-    // Increase iterator for an account
-    it->second.first++;
-  }
-  while (!head_transactions.empty()) {
-    // Take transactions with highest gas and put it in ordered transactions
-    auto head_trx = head_transactions.begin();
-    ret.push_back(head_trx->second);
-    if (ret.size() == count) {
+  ret.reserve(std::min<uint64_t>(count, queue_transactions_.size()));
+
+  // Next nonce transactions of accounts which head transaction was already taken, iterators point to the next nonce
+  // transaction and to the end of account transactions
+  std::map<PriorityKey, std::pair<NonceTransactions::const_iterator, NonceTransactions::const_iterator>,
+           std::greater<PriorityKey>>
+      next_transactions;
+
+  auto head_it = head_transactions_.begin();
+  while (ret.size() < count) {
+    NonceTransactions::const_iterator next_it, end_it;
+    if (!next_transactions.empty() &&
+        (head_it == head_transactions_.end() || next_transactions.begin()->first > head_it->first)) {
+      // Take transaction with highest gas price from next nonce transactions
+      const auto taken_it = next_transactions.begin();
+      ret.push_back(taken_it->second.first->second);
+      next_it = std::next(taken_it->second.first);
+      end_it = taken_it->second.second;
+      next_transactions.erase(taken_it);
+    } else if (head_it != head_transactions_.end()) {
+      // Take transaction with highest gas price from head transactions
+      ret.push_back(head_it->second);
+      const auto &account_transactions = account_nonce_transactions_.find(head_it->second->getSender())->second;
+      next_it = std::next(account_transactions.begin());
+      end_it = account_transactions.end();
+      head_it++;
+    } else {
       break;
     }
-    // If there is next nonce transaction of same account put it in head transactions
-    auto &it = iterators[head_trx->second->getSender()];
-    head_transactions.erase(head_trx);
-    if (it.first != it.second) {
-      head_transactions.insert({it.first->second->getGasPrice(), it.first->second});
-      it.first++;
+
+    // If there is next nonce transaction of same account put it in next nonce transactions
+    if (next_it != end_it) {
+      next_transactions.emplace(PriorityKey{next_it->second->getGasPrice(), next_it->second->getHash()},
+                                std::make_pair(next_it, end_it));
     }
   }
 
@@ -87,15 +91,71 @@ bool TransactionQueue::erase(const trx_hash_t &hash) {
   assert(nonce_it != account_it->second.end());
   assert(hash == nonce_it->second->getHash());
 
+  const auto account = it->second->getSender();
+  unindexAccount(account);
+  auto &gas_prices = account_gas_prices_[account];
+  gas_prices.erase(gas_prices.find(it->second->getGasPrice()));
   account_it->second.erase(nonce_it);
   if (account_it->second.size() == 0) {
     account_nonce_transactions_.erase(account_it);
+    account_gas_prices_.erase(account);
+  } else {
+    indexAccount(account);
   }
   queue_transactions_.erase(it);
 
   return true;
 }
 
+void TransactionQueue::unindexAccount(const addr_t &account) {
+  const auto account_it = account_nonce_transactions_.find(account);
+  if (account_it == account_nonce_transactions_.end() || account_it->second.empty()) {
+    return;
+  }
+
+  const auto &head_trx = account_it->second.begin()->second;
+  head_transactions_.erase({head_trx->getGasPrice(), head_trx->getHash()});
+  accounts_by_min_gas_price_.erase({*account_gas_prices_[account].begin(), account});
+}
+
+void TransactionQueue::indexAccount(const addr_t &account) {
+  const auto account_it = account_nonce_transactions_.find(account);
+  if (account_it == account_nonce_transactions_.end() || account_it->second.empty()) {
+    return;
+  }
+
+  const auto &head_trx = account_it->second.begin()->second;
+  head_transactions_.emplace(PriorityKey{head_trx->getGasPrice(), head_trx->getHash()}, head_trx);
+  accounts_by_min_gas_price_.emplace(*account_gas_prices_[account].begin(), account);
+}
+
+std::optional<val_t> TransactionQueue::lowestGasPrice() const {
+  if (accounts_by_min_gas_price_.empty()) {
+    return {};
+  }
+  return accounts_by_min_gas_price_.begin()->first;
+}
+
+std::optional<trx_hash_t> TransactionQueue::evictTransaction() {
+  // Transactions of an account are ordered by nonce so its last nonce transaction can never be taken before any other
+  // transaction of the same account. The account with the lowest gas price transaction is the last one to be exhausted
+  // while ordering, so its last nonce transaction is the last one in the ordered transactions.
+  if (accounts_by_min_gas_price_.empty()) {
+    return {};
+  }
+  const auto &account = accounts_by_min_gas_price_.begin()->second;
+  const auto trx_hash = account_nonce_transactions_[account].rbegin()->second->getHash();
+  transaction_overflow_time_ = std::chrono::system_clock::now();
+  erase(trx_hash);
+  known_txs_.erase(trx_hash);
+  return trx_hash;
+}
+
+void TransactionQueue::evictTransactions(size_t count) {
+  for (size_t i = 0; i < count && evictTransaction(); i++) {
+  }
+}
+
 bool TransactionQueue::insert(std::shared_ptr<Transaction> &&transaction, const TransactionStatus status,
                               uint64_t last_block_number) {
   assert(transaction);
@@ -107,15 +167,21 @@ bool TransactionQueue::insert(std::shared_ptr<Transaction> &&transaction, const
 
   switch (status) {
     case TransactionStatus::Verified: {
-      const auto &account_it = account_nonce_transactions_.find(transaction->getSender());
-      if (account_it == account_nonce_transactions_.end()) {
-        account_nonce_transactions_[transaction->getSender()][transaction->getNonce()] = transaction;
+      const auto &account = transaction->getSender();
+      const auto &account_it = account_nonce_transactions_.find(account);
+      const auto insert_transaction = [&]() {
+        unindexAccount(account);
+        account_gas_prices_[account].insert(transaction->getGasPrice());
+        account_nonce_transactions_[account][transaction->getNonce()] = transaction;
         queue_transactions_[tx_hash] = transaction;
+        indexAccount(account);
+      };
+      if (account_it == account_nonce_transactions_.end()) {
+        insert_transaction();
       } else {
         const auto &nonce_it = account_it->second.find(transaction->getNonce());
         if (nonce_it == account_it->second.end()) {
-          account_nonce_transactions_[transaction->getSender()][transaction->getNonce()] = transaction;
-          queue_transactions_[tx_hash] = transaction;
+          insert_transaction();
         } else {
           // It should not be possible that transaction is already inside due to verification done before
           assert(nonce_it->second->getHash() != tx_hash);
@@ -123,10 +189,10 @@ bool TransactionQueue::insert(std::shared_ptr<Transaction> &&transaction, const
           if (transaction->getGasPrice() > nonce_it->second->getGasPrice()) {
             // Place same nonce transaction with lower gas price in non propsable transactions since it could be
             // possible that some dag block might contain it
-            non_proposable_transactions_[nonce_it->second->getHash()] = {last_block_number, nonce_it->second};
-            queue_transactions_.erase(nonce_it->second->getHash());
-            account_nonce_transactions_[transaction->getSender()][transaction->getNonce()] = transaction;
-            queue_transactions_[tx_hash] = transaction;
+            auto replaced_transaction = nonce_it->second;
+            non_proposable_transactions_[replaced_transaction->getHash()] = {last_block_number, replaced_transaction};
+            erase(replaced_transaction->getHash());
+            insert_transaction();
           } else {
             non_proposable_transactions_[tx_hash] = {last_block_number, transaction};
           }
@@ -135,16 +201,8 @@ bool TransactionQueue::insert(std::shared_ptr<Transaction> &&transaction, const
 
       const auto queue_size = size();
       // This check if priority_queue_ is not bigger than max size if so we delete 1% of transactions
-      if (queue_size > kMaxSize) [[unlikely]] {
-        auto ordered_transactions = getOrderedTransactions(queue_size);
-        uint32_t counter = 0;
-        for (auto it = ordered_transactions.rbegin(); it != ordered_transactions.rend(); it++) {
-          transaction_overflow_time_ = std::chrono::system_clock::now();
-          erase((*it)->getHash());
-          known_txs_.erase((*it)->getHash());
-          counter++;
-          if (counter >= queue_size / 100) break;
-        }
+      if (kLimited && queue_size > kMaxSize) [[unlikely]] {
+        evictTransactions(std::max<size_t>(queue_size / 100, 1));
         if (!queue_transactions_.contains(tx_hash)) {
           return false;
         }
@@ -153,7 +211,7 @@ bool TransactionQueue::insert(std::shared_ptr<Transaction> &&transaction, const
     } break;
     case TransactionStatus::LowNonce:
     case TransactionStatus::InsufficentBalance:
-      if (non_proposable_transactions_.size() <= kNonProposableTransactionsMaxSize) {
+      if (!kLimited || non_proposable_transactions_.size() <= kNonProposableTransactionsMaxSize) {
         non_proposable_transactions_[tx_hash] = {last_block_number, transaction};
         known_txs_.insert(tx_hash);
       } else {
@@ -186,6 +244,8 @@ bool TransactionQueue::nonProposableTransactionsOverTheLimit() const {
   return non_proposable_transactions_.size() >= kNonProposableTransactionsMaxSize;
 }
 
+size_t TransactionQueue::nonProposableTransactionsSize() const { return non_proposable_transactions_.size(); }
+
 void TransactionQueue::markTransactionKnown(const trx_hash_t &trx_hash) { known_txs_.insert(trx_hash); }
 
 bool TransactionQueue::isTransactionKnown(const trx_hash_t &trx_hash) const { return known_txs_.contains(trx_hash); }
@@ -14,7 +14,8 @@ class Transaction final : public std::enable_shared_from_this<Transaction> {
  public:
   explicit Transaction(std::shared_ptr<::taraxa::final_chain::FinalChain> final_chain,
                        std::shared_ptr<::taraxa::TransactionManager> trx_manager,
-                       std::shared_ptr<::taraxa::Transaction> transaction) noexcept;
+                       std::shared_ptr<::taraxa::Transaction> transaction,
+                       std::optional<::taraxa::final_chain::TransactionReceipt> receipt = {}) noexcept;
 
   response::Value getHash() const noexcept;
   response::Value getNonce() const noexcept;
@@ -97,10 +97,17 @@ std::optional<std::vector<std::shared_ptr<object::Transaction>>> Block::getTrans
     transactions_ = final_chain_->transactions(block_header_->number);
     if (!transactions_.size()) return std::nullopt;
   }
+  // Receipts of all the transactions are read at once instead of a lookup per transaction
+  auto receipts = final_chain_->block_receipts(block_header_->number);
   ret.reserve(transactions_.size());
-  for (auto& t : transactions_) {
-    ret.emplace_back(
-        std::make_shared<object::Transaction>(std::make_shared<Transaction>(final_chain_, trx_manager_, t)));
+  for (size_t i = 0; i < transactions_.size(); ++i) {
+    // Missing receipt is looked up by the transaction itself
+    std::optional<::taraxa::final_chain::TransactionReceipt> receipt;
+    if (i < receipts.size()) {
+      receipt = std::move(receipts[i]);
+    }
+    ret.emplace_back(std::make_shared<object::Transaction>(
+        std::make_shared<Transaction>(final_chain_, trx_manager_, transactions_[i], std::move(receipt))));
   }
   return ret;
 }
@@ -105,7 +105,6 @@ HttpProcessor::Response GraphQlHttpProcessor::createOkResponse(std::string&& res
   response.set("Content-Type", "application/json");
   response.set("Access-Control-Allow-Origin", "*");
   response.set("Access-Control-Allow-Headers", "Accept, Accept-Language, Content-Language, Content-Type");
-  response.set("Connection", "close");
   response.result(boost::beast::http::status::ok);
   response.body() = std::move(response_body);
   response.prepare_payload();
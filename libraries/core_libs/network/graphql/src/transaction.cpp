@@ -13,10 +13,12 @@ namespace graphql::taraxa {
 
 Transaction::Transaction(std::shared_ptr<::taraxa::final_chain::FinalChain> final_chain,
                          std::shared_ptr<::taraxa::TransactionManager> trx_manager,
-                         std::shared_ptr<::taraxa::Transaction> transaction) noexcept
+                         std::shared_ptr<::taraxa::Transaction> transaction,
+                         std::optional<::taraxa::final_chain::TransactionReceipt> receipt) noexcept
     : final_chain_(std::move(final_chain)),
       trx_manager_(std::move(trx_manager)),
-      transaction_(std::move(transaction)) {}
+      transaction_(std::move(transaction)),
+      receipt_(std::move(receipt)) {}
 
 response::Value Transaction::getHash() const noexcept { return response::Value(transaction_->getHash().toString()); }
 
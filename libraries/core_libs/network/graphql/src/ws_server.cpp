@@ -90,7 +90,9 @@ void GraphQlWsSession::triggerTestSubscribtion(unsigned int number) {
   }
 
   LOG(log_tr_) << "***triggerTestSubscribtion: Before executor.post ";
-  boost::asio::post(executor, [this, response = std::move(response)]() mutable { writeImpl(std::move(response)); });
+  boost::asio::post(executor, [this, response = std::move(response)]() mutable {
+    writeImpl({std::make_shared<const std::string>(std::move(response)), {}});
+  });
   LOG(log_tr_) << "***triggerTestSubscribtion: After executors.post ";
 }
 
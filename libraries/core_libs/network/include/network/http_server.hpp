@@ -3,6 +3,8 @@
 #include <atomic>
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
+#include <chrono>
+#include <deque>
 
 #include "common/types.hpp"
 #include "logger/logger.hpp"
@@ -20,10 +22,19 @@ class HttpProcessor {
 class HttpConnection;
 class HttpHandler;
 
+struct HttpServerConfig {
+  // Time after which a persistent connection without any pending request is closed
+  std::chrono::seconds idle_timeout{30};
+  // Connection is closed after responding to this number of requests
+  uint32_t max_requests_per_connection = 1000;
+  // New connections are refused when this number of connections is open
+  uint32_t max_connections = 1000;
+};
+
 class HttpServer : public std::enable_shared_from_this<HttpServer> {
  public:
   HttpServer(boost::asio::io_context& io, boost::asio::ip::tcp::endpoint ep, const addr_t& node_addr,
-             const std::shared_ptr<HttpProcessor>& request_processor);
+             const std::shared_ptr<HttpProcessor>& request_processor, const HttpServerConfig& config = {});
 
   virtual ~HttpServer() { HttpServer::stop(); }
 
@@ -39,9 +50,11 @@ class HttpServer : public std::enable_shared_from_this<HttpServer> {
 
  protected:
   std::shared_ptr<HttpProcessor> request_processor_;
+  const HttpServerConfig config_;
 
  private:
   std::atomic<bool> stopped_ = true;
+  std::atomic<uint32_t> connections_count_ = 0;
   boost::asio::io_context& io_context_;
   boost::asio::ip::tcp::acceptor acceptor_;
   boost::asio::ip::tcp::endpoint ep_;
@@ -57,20 +70,48 @@ class HttpServer : public std::enable_shared_from_this<HttpServer> {
 // QQ:
 // atomic_flag responded, is RpcConnection multithreaded??
 
+/**
+ * @brief Persistent HTTP/1.1 connection. Pipelined requests are read and processed concurrently while their responses
+ * are written in the order of requests. All the connection state is accessed only from the strand of its socket.
+ */
 class HttpConnection : public std::enable_shared_from_this<HttpConnection> {
  public:
+  // Max number of requests that are read ahead and processed while their responses were not written yet
+  static constexpr size_t kMaxPipelinedRequests = 16;
+
   explicit HttpConnection(const std::shared_ptr<HttpServer>& http_server);
-  virtual ~HttpConnection() = default;
+  virtual ~HttpConnection();
   boost::asio::ip::tcp::socket& getSocket() { return socket_; }
   virtual std::shared_ptr<HttpConnection> getShared();
   void read();
 
  protected:
+  struct PendingResponse {
+    HttpProcessor::Response response;
+    bool ready = false;
+  };
+
+  void process(std::shared_ptr<PendingResponse> pending, HttpProcessor::Request&& request, bool keep_alive);
+  void write();
+  void armIdleTimer();
+  void disarmIdleTimer();
+  void close();
+
   std::shared_ptr<HttpServer> server_;
   boost::asio::ip::tcp::socket socket_;
+  boost::asio::steady_timer idle_timer_;
+  // Incremented on every arm and disarm of idle_timer_, so expiry of a previous arm is ignored
+  uint64_t idle_timer_generation_ = 0;
   boost::beast::flat_buffer buffer_;
   boost::beast::http::request<boost::beast::http::string_body> request_;
-  boost::beast::http::response<boost::beast::http::string_body> response_;
+  // Responses in the order of requests
+  std::deque<std::shared_ptr<PendingResponse>> pending_responses_;
+  uint32_t requests_count_ = 0;
+  bool reading_ = false;
+  bool writing_ = false;
+  // Set once the last request of the connection was read, no more requests are read after it
+  bool last_request_read_ = false;
+  bool closed_ = false;
 };
 
 }  // namespace taraxa::net
\ No newline at end of file
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <future>
+#include <mutex>
+
+#include "common/thread_pool.hpp"
 #include "network/tarcap/packets_handlers/common/ext_syncing_packet_handler.hpp"
 
 namespace taraxa {
@@ -23,6 +28,16 @@ class DagBlockPacketHandler final : public ExtSyncingPacketHandler {
   void onNewBlockReceived(DagBlock &&block, const std::shared_ptr<TaraxaPeer> &peer = nullptr);
   void onNewBlockVerified(DagBlock &&block, bool proposed, SharedTransactions &&trxs);
 
+  /**
+   * @brief Starts stateless (VDF/VRF) verification of received dag block on verification_pool_. It is called as soon
+   *        as the packet is received, so blocks of any level are verified concurrently, while processing of the packet
+   *        itself (transactions, tips, insertion into DAG) stays ordered by dag level. Verification is started only
+   *        for valid packets of known peers and is skipped when the pool has too many pending verifications
+   *
+   * @param packet_data DagBlockPacket data
+   */
+  void startBlockVerification(const PacketData &packet_data);
+
   // Packet type that is processed by this handler
   static constexpr SubprotocolPacketType kPacketType_ = SubprotocolPacketType::DagBlockPacket;
 
@@ -30,8 +45,39 @@ class DagBlockPacketHandler final : public ExtSyncingPacketHandler {
   void validatePacketRlpFormat(const PacketData &packet_data) const override;
   void process(const PacketData &packet_data, const std::shared_ptr<TaraxaPeer> &peer) override;
 
+  /**
+   * @brief Waits for the result of block verification started by startBlockVerification (if any). Verification which
+   *        is still queued is cancelled instead of waited for, so block is verified inline
+   *
+   * @param block
+   * @return VerifyBlockReturnType::Verified if block was successfully verified in advance, otherwise std::nullopt
+   */
+  std::optional<DagManager::VerifyBlockReturnType> takeBlockVdfVerification(const DagBlock &block);
+
   std::shared_ptr<TestState> test_state_;
   std::shared_ptr<TransactionManager> trx_mgr_{nullptr};
+
+  // Block hash is part of the result so it can be checked that it belongs to exactly the same block
+  using BlockVdfVerification = std::pair<blk_hash_t, DagManager::VerifyBlockReturnType>;
+
+  // Max number of verifications queued or running in verification_pool_, new ones are not started above it
+  static constexpr size_t kMaxQueuedVdfVerifications = 256;
+  // Max number of verifications which were not yet taken by processing of their packets
+  static constexpr size_t kMaxPendingVdfVerifications = 10000;
+
+  struct VdfVerification {
+    enum State { Queued, Started, Cancelled };
+    std::atomic<State> state = Queued;
+    std::promise<BlockVdfVerification> promise;
+    std::shared_future<BlockVdfVerification> result = promise.get_future().share();
+  };
+
+  // Verifications are keyed by block signature, which can be cheaply extracted from rlp without decoding the block
+  std::mutex vdf_verifications_mutex_;
+  std::unordered_map<sig_t, std::shared_ptr<VdfVerification>, sig_t::hash> vdf_verifications_;
+
+  // Declared last so pool threads are joined before the rest of members are destroyed
+  util::ThreadPool verification_pool_;
 };
 
 }  // namespace taraxa::network::tarcap
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <mutex>
+
+#include "common/thread_pool.hpp"
 #include "dag/dag_block.hpp"
 #include "network/tarcap/packets_handlers/common/packet_handler.hpp"
 #include "transaction/transaction.hpp"
@@ -47,17 +51,46 @@ class TransactionPacketHandler final : public PacketHandler {
   // Used only for unit tests
   void onNewTransactions(const SharedTransactions& transactions);
 
+  /**
+   * @brief Returns number of transactions senders recovered per second since the previous call of this method
+   *
+   * @return recovered transactions per second
+   */
+  double getRecoveredTransactionsPerSecond();
+
  private:
   void validatePacketRlpFormat(const PacketData& packet_data) const override;
   void process(const PacketData& packet_data, const std::shared_ptr<TaraxaPeer>& peer) override;
 
+  /**
+   * @brief Decodes transactions from packet and recovers their hashes and senders in parallel on crypto_pool_
+   * @note Invalid signatures are not reported here, they are reported by TransactionManager::verifyTransaction
+   *
+   * @param packet_data
+   * @param trx_indexes indexes of transactions in packet to be decoded
+   * @return decoded transactions in the same order as trx_indexes
+   * @throws MaliciousPeerException if transaction cannot be parsed
+   */
+  SharedTransactions recoverTransactions(const PacketData& packet_data, const std::vector<size_t>& trx_indexes);
+
+  // Batches smaller than this are recovered directly on the packet processing thread
+  static constexpr size_t kMinTransactionsRecoveryBatch = 16;
+
   std::shared_ptr<TransactionManager> trx_mgr_;
 
+  // Thread pool dedicated to the transactions senders recovery
+  util::ThreadPool crypto_pool_;
+
   // FOR TESTING ONLY
   std::shared_ptr<TestState> test_state_;
 
   std::atomic<uint64_t> received_trx_count_{0};
   std::atomic<uint64_t> unique_received_trx_count_{0};
+
+  std::atomic<uint64_t> recovered_trx_count_{0};
+  std::mutex recovery_rate_mutex_;
+  uint64_t last_recovered_trx_count_{0};
+  std::chrono::steady_clock::time_point last_recovery_rate_time_{std::chrono::steady_clock::now()};
 };
 
 }  // namespace taraxa::network::tarcap
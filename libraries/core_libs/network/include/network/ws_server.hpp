@@ -8,10 +8,11 @@
 #include <boost/beast/core.hpp>
 #include <boost/beast/websocket.hpp>
 #include <cstdlib>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <memory>
-#include <queue>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -19,6 +20,7 @@
 #include "config/config.hpp"
 #include "dag/dag_block.hpp"
 #include "final_chain/data.hpp"
+#include "network/rpc/eth/LogsDispatcher.hpp"
 #include "pbft/pbft_chain.hpp"
 
 namespace taraxa::net {
@@ -28,15 +30,70 @@ namespace http = beast::http;            // from <boost/beast/http.hpp>
 namespace websocket = beast::websocket;  // from <boost/beast/websocket.hpp>
 using tcp = boost::asio::ip::tcp;        // from <boost/asio/ip/tcp.hpp>
 
+/**
+ * @brief Message queued to a session. Body can be shared by messages of many sessions, so only the tail is specific
+ * to the session
+ */
+struct WsMessage {
+  std::shared_ptr<const std::string> body;
+  std::string tail;
+  // Subscription the message is notification of, 0 for responses to requests
+  int subscription_id = 0;
+
+  size_t size() const { return body->size() + tail.size(); }
+  std::string toString() const { return *body + tail; }
+};
+
+struct WsServerConfig {
+  enum class SlowConsumerPolicy {
+    // Oldest queued notifications are dropped
+    DropOldest,
+    // Oldest queued notifications that have a newer notification of the same subscription in the queue are dropped
+    // first, for subscriptions where only the latest event matters
+    Coalesce,
+    // Session is disconnected
+    Disconnect,
+  };
+
+  // Limits of messages queued for sending to a single session, 0 = unlimited
+  uint32_t max_queue_messages = 1000;
+  uint64_t max_queue_bytes = 16 * 1024 * 1024;
+  // What happens when a session does not read its messages fast enough and exceeds the limits
+  SlowConsumerPolicy slow_consumer_policy = SlowConsumerPolicy::DropOldest;
+  // Max number of logs subscriptions of a single session, 0 = unlimited
+  uint32_t max_logs_subscriptions = 100;
+};
+
+// Send queues of all the sessions of a server, shared with the sessions as they can outlive the server
+struct WsQueueStats {
+  std::atomic<uint64_t> queued_messages = 0;
+  std::atomic<uint64_t> queued_bytes = 0;
+  std::atomic<uint64_t> dropped_messages = 0;
+  std::atomic<uint64_t> disconnected_sessions = 0;
+};
+
+/**
+ * @brief Subscription notification that is serialized once for all the subscribed sessions. Result is serialized on
+ * the first request of a message, so events without subscribers are never serialized. Not thread safe, messages are
+ * created by the thread that emits the event.
+ */
+class SubscriptionEvent {
+ public:
+  explicit SubscriptionEvent(std::function<Json::Value()>&& result_fn) : result_fn_(std::move(result_fn)) {}
+
+  WsMessage message(int subscription_id) const;
+
+ private:
+  std::function<Json::Value()> result_fn_;
+  mutable std::shared_ptr<const std::string> body_;
+};
+
 class WsServer;
 class WsSession : public std::enable_shared_from_this<WsSession> {
  public:
   // Take ownership of the socket
-  explicit WsSession(tcp::socket&& socket, addr_t node_addr, std::shared_ptr<WsServer> ws_server)
-      : ws_(std::move(socket)) {
-    LOG_OBJECTS_CREATE("WS_SESSION");
-    ws_server_ = ws_server;
-  }
+  explicit WsSession(tcp::socket&& socket, addr_t node_addr, std::shared_ptr<WsServer> ws_server);
+  virtual ~WsSession();
 
   // Start the asynchronous operation
   void run();
@@ -49,28 +106,46 @@ class WsSession : public std::enable_shared_from_this<WsSession> {
 
   virtual std::string processRequest(const std::string_view& request) = 0;
 
-  void newEthBlock(::taraxa::final_chain::BlockHeader const& payload);
-  void newDagBlock(DagBlock const& blk);
-  void newDagBlockFinalized(blk_hash_t const& blk, uint64_t period);
-  void newPbftBlockExecuted(Json::Value const& payload);
-  void newPendingTransaction(trx_hash_t const& trx_hash);
+  void newEthBlock(SubscriptionEvent const& event);
+  void newDagBlock(SubscriptionEvent const& event);
+  void newDagBlockFinalized(SubscriptionEvent const& event);
+  void newPbftBlockExecuted(SubscriptionEvent const& event);
+  void newPendingTransaction(SubscriptionEvent const& event);
+  void newLog(int subscription_id, SubscriptionEvent const& event);
+  // Cancels subscription of any type, returns false if there is no such subscription
+  bool unsubscribe(int subscription_id);
   bool is_closed() const { return closed_; }
   bool is_normal(const beast::error_code& ec) const;
   LOG_OBJECTS_DEFINE
 
  protected:
-  void writeImpl(std::string&& message);
+  void notify(int subscription_id, SubscriptionEvent const& event);
+  void writeImpl(WsMessage&& message);
   void write();
-  std::queue<std::string> queue_messages_;
+  bool queueLimitsExceeded() const;
+  void applySlowConsumerPolicy();
+  void dropQueuedMessage(std::deque<WsMessage>::iterator message);
+  // Removes logs subscriptions of the session from the server, called once the session is closed
+  void unsubscribeAllLogs();
+  // Messages waiting for the write of the previous message, accessed only from the session strand
+  std::deque<WsMessage> queue_messages_;
+  uint64_t queued_bytes_ = 0;
+  bool writing_ = false;
+  const WsServerConfig config_;
+  const std::shared_ptr<WsQueueStats> queue_stats_;
   websocket::stream<beast::tcp_stream> ws_;
   beast::flat_buffer buffer_;
-  std::string write_buffer_;
+  WsMessage write_buffer_;
   int subscription_id_ = 0;
   int new_heads_subscription_ = 0;
   int new_dag_blocks_subscription_ = 0;
   int new_transactions_subscription_ = 0;
   int new_dag_block_finalized_subscription_ = 0;
   int new_pbft_block_executed_subscription_ = 0;
+  // Subscription id -> id of the subscription in server logs dispatcher, guarded by logs_subscriptions_mtx_ as the
+  // session can be closed from other threads
+  std::unordered_map<int, rpc::eth::LogsDispatcher::SubscriberID> logs_subscriptions_;
+  std::mutex logs_subscriptions_mtx_;
   std::atomic<bool> closed_ = false;
   std::weak_ptr<WsServer> ws_server_;
 };
@@ -80,7 +155,7 @@ class WsSession : public std::enable_shared_from_this<WsSession> {
 // Accepts incoming connections and launches the sessions
 class WsServer : public std::enable_shared_from_this<WsServer>, public jsonrpc::AbstractServerConnector {
  public:
-  WsServer(boost::asio::io_context& ioc, tcp::endpoint endpoint, addr_t node_addr);
+  WsServer(boost::asio::io_context& ioc, tcp::endpoint endpoint, addr_t node_addr, const WsServerConfig& config = {});
   virtual ~WsServer();
 
   WsServer(const WsServer&) = delete;
@@ -95,15 +170,27 @@ class WsServer : public std::enable_shared_from_this<WsServer>, public jsonrpc::
   void newDagBlockFinalized(blk_hash_t const& blk, uint64_t period);
   void newPbftBlockExecuted(PbftBlock const& sche_blk, std::vector<blk_hash_t> const& finalized_dag_blk_hashes);
   void newPendingTransaction(trx_hash_t const& trx_hash);
+  void newLogs(::taraxa::final_chain::BlockHeader const& header, SharedTransactions const& trxs,
+               ::taraxa::final_chain::TransactionReceipts const& receipts);
+
+  // Logs subscriptions of all the sessions are matched against new logs by single dispatcher
+  rpc::eth::LogsDispatcher::SubscriberID subscribeLogs(std::shared_ptr<WsSession> const& session, int subscription_id,
+                                                       rpc::eth::LogFilter&& filter);
+  void unsubscribeLogs(rpc::eth::LogsDispatcher::SubscriberID id);
+  size_t numLogsSubscriptions();
 
   virtual std::shared_ptr<WsSession> createSession(tcp::socket&& socket) = 0;
 
+  const WsServerConfig& config() const { return config_; }
+  std::shared_ptr<WsQueueStats> const& queueStats() const { return queue_stats_; }
+
   virtual bool StartListening() { return true; }
   virtual bool StopListening() { return true; }
 
  private:
   void do_accept();
   void on_accept(beast::error_code ec, tcp::socket socket);
+  void removeClosedLogsSubscriptions();
   LOG_OBJECTS_DEFINE
   boost::asio::io_context& ioc_;
   tcp::acceptor acceptor_;
@@ -111,8 +198,19 @@ class WsServer : public std::enable_shared_from_this<WsServer>, public jsonrpc::
   std::atomic<bool> stopped_ = false;
   boost::shared_mutex sessions_mtx_;
 
+  struct LogsSubscription {
+    std::weak_ptr<WsSession> session;
+    int subscription_id = 0;
+  };
+  rpc::eth::LogsDispatcher logs_dispatcher_;
+  std::unordered_map<rpc::eth::LogsDispatcher::SubscriberID, LogsSubscription> logs_subscriptions_;
+  rpc::eth::LogsDispatcher::SubscriberID logs_subscription_seq_ = 0;
+  std::shared_mutex logs_subscriptions_mtx_;
+
  protected:
   const addr_t node_addr_;
+  const WsServerConfig config_;
+  const std::shared_ptr<WsQueueStats> queue_stats_ = std::make_shared<WsQueueStats>();
 };
 
 }  // namespace taraxa::net
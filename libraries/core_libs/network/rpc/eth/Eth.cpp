@@ -18,7 +18,11 @@ class EthImpl : public Eth, EthParams {
   Watches watches_;
 
  public:
-  EthImpl(EthParams&& prerequisites) : EthParams(std::move(prerequisites)), watches_(watches_cfg) {}
+  EthImpl(EthParams&& prerequisites) : EthParams(std::move(prerequisites)), watches_(watches_cfg) {
+    if (!logs_query_engine) {
+      logs_query_engine = std::make_shared<LogsQueryEngine>();
+    }
+  }
 
   virtual RPCModules implementedModules() const override { return RPCModules{RPCModule{"eth", "1.0"}}; }
 
@@ -143,13 +147,13 @@ class EthImpl : public Eth, EthParams {
 
   Json::Value eth_getFilterLogs(string const& _filterId) override {
     if (auto filter = watches_.logs_.get_watch_params(jsToInt(_filterId))) {
-      return toJsonArray(filter->match_all(*final_chain));
+      return toJsonArray(logs_query_engine->query(*filter, *final_chain));
     }
     return Json::Value(Json::arrayValue);
   }
 
   Json::Value eth_getLogs(Json::Value const& _json) override {
-    return toJsonArray(parse_log_filter(_json).match_all(*final_chain));
+    return toJsonArray(logs_query_engine->query(parse_log_filter(_json), *final_chain));
   }
 
   Json::Value eth_syncing() override {
@@ -345,14 +349,16 @@ class EthImpl : public Eth, EthParams {
   }
 
   LogFilter parse_log_filter(Json::Value const& json) {
-    EthBlockNumber from_block;
+    return parse_log_filter(json, final_chain->last_block_number());
+  }
+
+  static LogFilter parse_log_filter(Json::Value const& json, EthBlockNumber last_block) {
+    EthBlockNumber from_block = last_block;
     optional<EthBlockNumber> to_block;
     AddressSet addresses;
     LogFilter::Topics topics;
     if (auto const& fromBlock = json["fromBlock"]; !fromBlock.empty()) {
-      from_block = parse_blk_num(fromBlock.asString());
-    } else {
-      from_block = final_chain->last_block_number();
+      from_block = parse_blk_num_specific(fromBlock.asString()).value_or(last_block);
     }
     if (auto const& toBlock = json["toBlock"]; !toBlock.empty()) {
       to_block = parse_blk_num_specific(toBlock.asString());
@@ -499,6 +505,12 @@ class EthImpl : public Eth, EthParams {
 
 Json::Value toJson(BlockHeader const& obj) { return EthImpl::toJson(obj); }
 
+Json::Value toJson(LocalisedLogEntry const& obj) { return EthImpl::toJson(obj); }
+
+LogFilter parseLogFilter(Json::Value const& json, EthBlockNumber last_block) {
+  return EthImpl::parse_log_filter(json, last_block);
+}
+
 shared_ptr<Eth> NewEth(EthParams&& prerequisites) { return make_shared<EthImpl>(std::move(prerequisites)); }
 
 }  // namespace taraxa::net::rpc::eth
\ No newline at end of file
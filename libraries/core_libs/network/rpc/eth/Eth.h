@@ -1,5 +1,6 @@
 #pragma once
 
+#include "LogsQueryEngine.hpp"
 #include "final_chain/final_chain.hpp"
 #include "network/rpc/EthFace.h"
 #include "watches.hpp"
@@ -16,6 +17,8 @@ struct EthParams {
   std::function<u256()> gas_pricer = [] { return u256(0); };
   std::function<std::optional<SyncStatus>()> syncing_probe = [] { return std::nullopt; };
   WatchesConfig watches_cfg;
+  // Shared by all the eth instances, default engine is created if not set
+  std::shared_ptr<LogsQueryEngine> logs_query_engine;
 };
 
 struct Eth : virtual ::taraxa::net::EthFace {
@@ -38,4 +41,9 @@ std::shared_ptr<Eth> NewEth(EthParams&&);
 
 Json::Value toJson(final_chain::BlockHeader const& obj);
 
+Json::Value toJson(LocalisedLogEntry const& obj);
+
+// Parses filter object of eth_newFilter, eth_getLogs and logs subscription, last_block is used for "latest" block
+LogFilter parseLogFilter(Json::Value const& json, EthBlockNumber last_block);
+
 }  // namespace taraxa::net::rpc::eth
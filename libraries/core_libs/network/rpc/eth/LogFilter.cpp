@@ -5,22 +5,25 @@ namespace taraxa::net::rpc::eth {
 LogFilter::LogFilter(EthBlockNumber from_block, std::optional<EthBlockNumber> to_block, AddressSet addresses,
                      LogFilter::Topics topics)
     : from_block_(from_block), to_block_(to_block), addresses_(std::move(addresses)), topics_(std::move(topics)) {
-  if (!addresses_.empty()) {
-    return;
+  address_hashes_.reserve(addresses_.size());
+  for (auto const& a : addresses_) {
+    address_hashes_.push_back(sha3(a));
   }
-  for (auto const& t : topics_) {
-    if (!t.empty()) {
-      return;
+  for (size_t i = 0; i < topics_.size(); ++i) {
+    topic_hashes_[i].reserve(topics_[i].size());
+    for (auto const& t : topics_[i]) {
+      topic_hashes_[i].push_back(sha3(t));
     }
   }
-  is_range_only_ = true;
+  is_range_only_ =
+      addresses_.empty() && std::all_of(topics_.begin(), topics_.end(), [](auto const& t) { return t.empty(); });
 }
 
 std::vector<LogBloom> LogFilter::bloomPossibilities() const {
   // return combination of each of the addresses/topics
   std::vector<LogBloom> ret;
   // | every address with every topic
-  for (auto const& i : addresses_) {
+  for (auto const& i : address_hashes_) {
     // 1st case, there are addresses and topics
     //
     // m_addresses = [a0, a1];
@@ -31,13 +34,13 @@ std::vector<LogBloom> LogFilter::bloomPossibilities() const {
     // a1 | t0, a1 | t1a | t1b
     // ]
     //
-    for (auto const& t : topics_) {
+    for (auto const& t : topic_hashes_) {
       if (t.empty()) {
         continue;
       }
-      auto b = LogBloom().shiftBloom<3>(sha3(i));
+      auto b = LogBloom().shiftBloom<3>(i);
       for (auto const& j : t) {
-        b = b.shiftBloom<3>(sha3(j));
+        b = b.shiftBloom<3>(j);
       }
       ret.push_back(b);
     }
@@ -51,8 +54,8 @@ std::vector<LogBloom> LogFilter::bloomPossibilities() const {
   // blooms = [a0, a1];
   //
   if (ret.empty()) {
-    for (auto const& i : addresses_) {
-      ret.push_back(LogBloom().shiftBloom<3>(sha3(i)));
+    for (auto const& i : address_hashes_) {
+      ret.push_back(LogBloom().shiftBloom<3>(i));
     }
   }
 
@@ -64,11 +67,11 @@ std::vector<LogBloom> LogFilter::bloomPossibilities() const {
   // blooms = [t0, t1a | t1b];
   //
   if (addresses_.empty()) {
-    for (auto const& t : topics_) {
+    for (auto const& t : topic_hashes_) {
       if (t.size()) {
         LogBloom b;
         for (auto const& j : t) {
-          b = b.shiftBloom<3>(sha3(j));
+          b = b.shiftBloom<3>(j);
         }
         ret.push_back(b);
       }
@@ -78,10 +81,10 @@ std::vector<LogBloom> LogFilter::bloomPossibilities() const {
 }
 
 bool LogFilter::matches(LogBloom b) const {
-  if (!addresses_.empty()) {
+  if (!address_hashes_.empty()) {
     auto ok = false;
-    for (auto const& i : addresses_) {
-      if (b.containsBloom<3>(sha3(i))) {
+    for (auto const& i : address_hashes_) {
+      if (b.containsBloom<3>(i)) {
         ok = true;
         break;
       }
@@ -90,13 +93,13 @@ bool LogFilter::matches(LogBloom b) const {
       return false;
     }
   }
-  for (auto const& t : topics_) {
+  for (auto const& t : topic_hashes_) {
     if (t.empty()) {
       continue;
     }
     auto ok = false;
     for (auto const& i : t) {
-      if (b.containsBloom<3>(sha3(i))) {
+      if (b.containsBloom<3>(i)) {
         ok = true;
         break;
       }
@@ -113,23 +116,24 @@ void LogFilter::match_one(TransactionReceipt const& r, std::function<void(size_t
     return;
   }
   for (size_t log_i = 0; log_i < r.logs.size(); ++log_i) {
-    auto const& e = r.logs[log_i];
-    if (!addresses_.empty() && !addresses_.count(e.address)) {
-      continue;
-    }
-    auto ok = true;
-    for (size_t i = 0; i < topics_.size(); ++i) {
-      if (!topics_[i].empty() && (e.topics.size() < i || !topics_[i].count(e.topics[i]))) {
-        ok = false;
-        break;
-      }
-    }
-    if (ok) {
+    if (matches(r.logs[log_i])) {
       cb(log_i);
     }
   }
 }
 
+bool LogFilter::matches(LogEntry const& e) const {
+  if (!addresses_.empty() && !addresses_.count(e.address)) {
+    return false;
+  }
+  for (size_t i = 0; i < topics_.size(); ++i) {
+    if (!topics_[i].empty() && (e.topics.size() <= i || !topics_[i].count(e.topics[i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool LogFilter::blk_number_matches(EthBlockNumber blk_n) const {
   return from_block_ <= blk_n && (!to_block_ || blk_n <= *to_block_);
 }
@@ -149,33 +153,51 @@ void LogFilter::match_one(ExtendedTransactionLocation const& trx_loc, Transactio
   }
 }
 
-std::vector<LocalisedLogEntry> LogFilter::match_all(FinalChain const& final_chain) const {
-  std::vector<LocalisedLogEntry> ret;
-  auto action = [&, this](EthBlockNumber blk_n) {
-    ExtendedTransactionLocation trx_loc{{{blk_n}, *final_chain.block_hash(blk_n)}};
-    auto hashes = final_chain.transaction_hashes(trx_loc.blk_n);
-    for (size_t i = 0; i < hashes->count(); ++i) {
-      trx_loc.trx_hash = hashes->get(i);
-      match_one(trx_loc, *final_chain.transaction_receipt(trx_loc.trx_hash),
-                [&](auto const& lle) { ret.push_back(lle); });
-      ++trx_loc.index;
-    }
-  };
-  auto to_blk_n = to_block_ ? *to_block_ : final_chain.last_block_number();
+EthBlockNumber LogFilter::to_block(FinalChain const& final_chain) const {
+  return to_block_ ? *to_block_ : final_chain.last_block_number();
+}
+
+std::vector<EthBlockNumber> LogFilter::candidate_blocks(FinalChain const& final_chain, EthBlockNumber from,
+                                                        EthBlockNumber to) const {
+  std::vector<EthBlockNumber> ret;
+  if (from > to) {
+    return ret;
+  }
   if (is_range_only_) {
-    for (auto blk_n = from_block_; blk_n <= to_blk_n; ++blk_n) {
-      action(blk_n);
+    ret.reserve(to - from + 1);
+    for (auto blk_n = from; blk_n <= to; ++blk_n) {
+      ret.push_back(blk_n);
     }
     return ret;
   }
-  std::set<EthBlockNumber> matchingBlocks;
   for (auto const& bloom : bloomPossibilities()) {
-    for (auto blk_n : final_chain.withBlockBloom(bloom, from_block_, to_blk_n)) {
-      matchingBlocks.insert(blk_n);
+    const auto blocks = final_chain.withBlockBloom(bloom, from, to);
+    ret.insert(ret.end(), blocks.begin(), blocks.end());
+  }
+  std::sort(ret.begin(), ret.end());
+  ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+  return ret;
+}
+
+void LogFilter::match_block(FinalChain const& final_chain, EthBlockNumber blk_n,
+                            std::vector<LocalisedLogEntry>& ret) const {
+  ExtendedTransactionLocation trx_loc{{{blk_n}, *final_chain.block_hash(blk_n)}};
+  auto hashes = final_chain.transaction_hashes(trx_loc.blk_n);
+  auto receipts = final_chain.block_receipts(trx_loc.blk_n);
+  for (size_t i = 0; i < hashes->count() && i < receipts.size(); ++i, ++trx_loc.index) {
+    // Receipt is not available anymore, e.g. it was pruned
+    if (!receipts[i]) {
+      continue;
     }
+    trx_loc.trx_hash = hashes->get(i);
+    match_one(trx_loc, *receipts[i], [&](auto const& lle) { ret.push_back(lle); });
   }
-  for (auto blk_n : matchingBlocks) {
-    action(blk_n);
+}
+
+std::vector<LocalisedLogEntry> LogFilter::match_all(FinalChain const& final_chain) const {
+  std::vector<LocalisedLogEntry> ret;
+  for (auto blk_n : candidate_blocks(final_chain, from_block_, to_block(final_chain))) {
+    match_block(final_chain, blk_n, ret);
   }
   return ret;
 }
@@ -13,6 +13,9 @@ struct LogFilter {
   std::optional<EthBlockNumber> to_block_;
   AddressSet addresses_;
   Topics topics_;
+  // Hashes used for bloom checks are computed once per filter
+  std::vector<h256> address_hashes_;
+  std::array<std::vector<h256>, 4> topic_hashes_;
   bool is_range_only_ = false;
 
  public:
@@ -22,12 +25,25 @@ struct LogFilter {
   std::vector<LogBloom> bloomPossibilities() const;
   bool matches(LogBloom b) const;
   void match_one(TransactionReceipt const& r, std::function<void(size_t)> const& cb) const;
+  // Checks addresses and topics of the log, block range is not checked
+  bool matches(LogEntry const& e) const;
 
  public:
   bool blk_number_matches(EthBlockNumber blk_n) const;
   void match_one(ExtendedTransactionLocation const& trx_loc, TransactionReceipt const& r,
                  std::function<void(LocalisedLogEntry const&)> const& cb) const;
   std::vector<LocalisedLogEntry> match_all(FinalChain const& final_chain) const;
+
+  AddressSet const& addresses() const { return addresses_; }
+  Topics const& topics() const { return topics_; }
+  bool is_range_only() const { return is_range_only_; }
+  EthBlockNumber from_block() const { return from_block_; }
+  EthBlockNumber to_block(FinalChain const& final_chain) const;
+  // Ordered blocks of [from, to] that may contain matching logs according to the log blooms index
+  std::vector<EthBlockNumber> candidate_blocks(FinalChain const& final_chain, EthBlockNumber from,
+                                               EthBlockNumber to) const;
+  // Appends matching logs of the block to ret
+  void match_block(FinalChain const& final_chain, EthBlockNumber blk_n, std::vector<LocalisedLogEntry>& ret) const;
 };
 
 }  // namespace taraxa::net::rpc::eth
\ No newline at end of file
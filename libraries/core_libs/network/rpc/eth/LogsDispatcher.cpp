@@ -0,0 +1,90 @@
+#include "LogsDispatcher.hpp"
+
+namespace taraxa::net::rpc::eth {
+
+template <typename Action>
+bool LogsDispatcher::visitIndexKeys(LogFilter const& filter, Action&& action) {
+  // Filter is indexed by a single dimension, so every log hits it at most once
+  if (!filter.addresses().empty()) {
+    for (auto const& address : filter.addresses()) {
+      action(by_address_, address);
+    }
+    return true;
+  }
+  for (size_t i = 0; i < filter.topics().size(); ++i) {
+    if (!filter.topics()[i].empty()) {
+      for (auto const& topic : filter.topics()[i]) {
+        action(by_topic_[i], topic);
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+void LogsDispatcher::add(SubscriberID id, LogFilter filter) {
+  std::unique_lock lock(mutex_);
+  removeImpl(id);
+  if (!visitIndexKeys(filter, [id](auto& index, auto const& key) { index[key].insert(id); })) {
+    match_all_.insert(id);
+  }
+  filters_.insert_or_assign(id, std::move(filter));
+}
+
+bool LogsDispatcher::remove(SubscriberID id) {
+  std::unique_lock lock(mutex_);
+  return removeImpl(id);
+}
+
+bool LogsDispatcher::removeImpl(SubscriberID id) {
+  auto filter = filters_.find(id);
+  if (filter == filters_.end()) {
+    return false;
+  }
+  visitIndexKeys(filter->second, [id](auto& index, auto const& key) {
+    if (auto subscribers = index.find(key); subscribers != index.end()) {
+      subscribers->second.erase(id);
+      if (subscribers->second.empty()) {
+        index.erase(subscribers);
+      }
+    }
+  });
+  match_all_.erase(id);
+  filters_.erase(filter);
+  return true;
+}
+
+size_t LogsDispatcher::size() const {
+  std::shared_lock lock(mutex_);
+  return filters_.size();
+}
+
+void LogsDispatcher::dispatch(ExtendedTransactionLocation const& trx_loc, TransactionReceipt const& receipt,
+                              Callback const& cb) const {
+  std::shared_lock lock(mutex_);
+  if (filters_.empty()) {
+    return;
+  }
+  auto notify = [&](Subscribers const& subscribers, LocalisedLogEntry const& lle) {
+    for (auto id : subscribers) {
+      auto const& filter = filters_.at(id);
+      if (filter.blk_number_matches(trx_loc.blk_n) && filter.matches(lle.le)) {
+        cb(id, lle);
+      }
+    }
+  };
+  for (size_t log_i = 0; log_i < receipt.logs.size(); ++log_i) {
+    LocalisedLogEntry const lle{receipt.logs[log_i], trx_loc, log_i};
+    notify(match_all_, lle);
+    if (auto subscribers = by_address_.find(lle.le.address); subscribers != by_address_.end()) {
+      notify(subscribers->second, lle);
+    }
+    for (size_t i = 0; i < lle.le.topics.size() && i < by_topic_.size(); ++i) {
+      if (auto subscribers = by_topic_[i].find(lle.le.topics[i]); subscribers != by_topic_[i].end()) {
+        notify(subscribers->second, lle);
+      }
+    }
+  }
+}
+
+}  // namespace taraxa::net::rpc::eth
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <shared_mutex>
+
+#include "LogFilter.hpp"
+
+namespace taraxa::net::rpc::eth {
+
+/**
+ * @brief Routes logs of new blocks to the subscribed log filters. Filters are indexed by their addresses, or by topics
+ * of their first constrained position if they have no addresses, so a log is checked only against filters that can
+ * match it instead of against all of them. Filters without addresses and topics match every log.
+ */
+class LogsDispatcher {
+ public:
+  using SubscriberID = uint64_t;
+  using Callback = std::function<void(SubscriberID, LocalisedLogEntry const&)>;
+
+  void add(SubscriberID id, LogFilter filter);
+  bool remove(SubscriberID id);
+  size_t size() const;
+
+  /**
+   * @brief Calls cb for every log of the receipt and every filter it matches, in order of logs. Callback must not
+   * add or remove filters
+   */
+  void dispatch(ExtendedTransactionLocation const& trx_loc, TransactionReceipt const& receipt,
+                Callback const& cb) const;
+
+ private:
+  using Subscribers = std::unordered_set<SubscriberID>;
+
+  bool removeImpl(SubscriberID id);
+
+  // Calls action for every index entry of the filter, returns false if the filter is not indexed
+  template <typename Action>
+  bool visitIndexKeys(LogFilter const& filter, Action&& action);
+
+  std::unordered_map<SubscriberID, LogFilter> filters_;
+  std::unordered_map<Address, Subscribers> by_address_;
+  std::array<std::unordered_map<h256, Subscribers>, std::tuple_size_v<LogFilter::Topics>> by_topic_;
+  Subscribers match_all_;
+  mutable std::shared_mutex mutex_;
+};
+
+}  // namespace taraxa::net::rpc::eth
@@ -0,0 +1,81 @@
+#include "LogsQueryEngine.hpp"
+
+namespace taraxa::net::rpc::eth {
+
+LogsQueryEngine::LogsQueryEngine(LogsQueryConfig const& config)
+    : config_(config), pool_(std::max<uint32_t>(config.threads, 1)) {}
+
+std::vector<LocalisedLogEntry> LogsQueryEngine::query(LogFilter const& filter, FinalChain const& final_chain) {
+  const auto start = std::chrono::steady_clock::now();
+  auto update_stats = [&] {
+    const auto latency =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    queries_++;
+    latency_total_us_ += latency;
+    last_latency_us_ = latency;
+  };
+  try {
+    auto ret = evaluate(filter, final_chain);
+    update_stats();
+    return ret;
+  } catch (...) {
+    rejected_queries_++;
+    update_stats();
+    throw;
+  }
+}
+
+std::vector<LocalisedLogEntry> LogsQueryEngine::evaluate(LogFilter const& filter, FinalChain const& final_chain) {
+  const auto from = filter.from_block();
+  const auto to = filter.to_block(final_chain);
+  if (from > to) {
+    return {};
+  }
+  if (config_.max_block_range && to - from >= config_.max_block_range) {
+    throw std::runtime_error("Block range of the query is limited to " + std::to_string(config_.max_block_range) +
+                             " blocks");
+  }
+
+  // Chunks are evaluated in waves, so a query that exceeds the results limit is terminated early and a query over a
+  // huge range doesn't flood the pool
+  const auto chunk_size = std::max<uint64_t>(config_.blocks_per_chunk, 1);
+  const uint64_t chunks_count = (to - from) / chunk_size + 1;
+  const uint64_t wave_size = pool_.capacity() * 2;
+  std::atomic<uint64_t> results_count = 0;
+  std::atomic<bool> limit_exceeded = false;
+  std::vector<LocalisedLogEntry> ret;
+  for (uint64_t wave_begin = 0; wave_begin < chunks_count && !limit_exceeded; wave_begin += wave_size) {
+    const auto wave_end = std::min(wave_begin + wave_size, chunks_count);
+    std::vector<std::vector<LocalisedLogEntry>> chunks_results(wave_end - wave_begin);
+    pool_.parallel_for(wave_end - wave_begin, [&](size_t wave_chunk) {
+      const auto chunk_from = from + (wave_begin + wave_chunk) * chunk_size;
+      const auto chunk_to = std::min(to, chunk_from + chunk_size - 1);
+      auto& chunk_results = chunks_results[wave_chunk];
+      for (auto blk_n : filter.candidate_blocks(final_chain, chunk_from, chunk_to)) {
+        if (limit_exceeded) {
+          return;
+        }
+        const auto size_before = chunk_results.size();
+        filter.match_block(final_chain, blk_n, chunk_results);
+        results_count += chunk_results.size() - size_before;
+        if (config_.max_results && results_count > config_.max_results) {
+          limit_exceeded = true;
+        }
+      }
+    });
+    for (auto& chunk_results : chunks_results) {
+      std::move(chunk_results.begin(), chunk_results.end(), std::back_inserter(ret));
+    }
+  }
+  if (limit_exceeded) {
+    throw std::runtime_error("Query returned more than " + std::to_string(config_.max_results) +
+                             " results, narrow the block range");
+  }
+  return ret;
+}
+
+LogsQueryStats LogsQueryEngine::stats() const {
+  return {queries_, rejected_queries_, latency_total_us_, last_latency_us_};
+}
+
+}  // namespace taraxa::net::rpc::eth
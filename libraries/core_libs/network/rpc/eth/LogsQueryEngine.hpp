@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+
+#include "LogFilter.hpp"
+#include "common/thread_pool.hpp"
+
+namespace taraxa::net::rpc::eth {
+
+struct LogsQueryConfig {
+  // Max number of blocks covered by a single query, 0 = unlimited
+  uint64_t max_block_range = 0;
+  // Max number of logs returned by a single query, 0 = unlimited
+  uint64_t max_results = 0;
+  // Number of threads evaluating chunks of all the queries
+  uint32_t threads = 4;
+  // Number of blocks evaluated as a single task
+  uint64_t blocks_per_chunk = 128;
+};
+
+struct LogsQueryStats {
+  uint64_t queries = 0;
+  // Failed queries, mostly rejected because of the block range or results count limits
+  uint64_t rejected_queries = 0;
+  uint64_t latency_total_us = 0;
+  uint64_t last_latency_us = 0;
+};
+
+/**
+ * @brief Evaluates log filters over big block ranges. The range is split into chunks that are evaluated in parallel on
+ * a pool shared by all the queries, so a wide query doesn't block an rpc thread for the whole range. Chunks are
+ * evaluated in bounded waves and their results are merged in block order. Query fails as soon as it exceeds the
+ * configured limits.
+ */
+class LogsQueryEngine {
+ public:
+  explicit LogsQueryEngine(LogsQueryConfig const& config = {});
+
+  std::vector<LocalisedLogEntry> query(LogFilter const& filter, FinalChain const& final_chain);
+
+  LogsQueryStats stats() const;
+
+ private:
+  std::vector<LocalisedLogEntry> evaluate(LogFilter const& filter, FinalChain const& final_chain);
+
+  const LogsQueryConfig config_;
+  util::ThreadPool pool_;
+
+  std::atomic<uint64_t> queries_ = 0;
+  std::atomic<uint64_t> rejected_queries_ = 0;
+  std::atomic<uint64_t> latency_total_us_ = 0;
+  std::atomic<uint64_t> last_latency_us_ = 0;
+};
+
+}  // namespace taraxa::net::rpc::eth
@@ -4,6 +4,7 @@
 #include <queue>
 
 #include "LogFilter.hpp"
+#include "LogsDispatcher.hpp"
 #include "common/global_const.hpp"
 #include "data.hpp"
 
@@ -88,21 +89,24 @@ class WatchGroup {
     return watches_.erase(watch_id);
   }
 
-  void uninstall_stale_watches() const {
+  std::vector<WatchID> uninstall_stale_watches() const {
     std::unique_lock l(watches_mu_);
-    bool did_uninstall = false;
-    for (auto& [id, watch] : watches_) {
+    std::vector<WatchID> uninstalled;
+    for (auto it = watches_.begin(); it != watches_.end();) {
       if (cfg_.idle_timeout <=
-          duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - watch.last_touched)) {
-        watches_.erase(id);
-        did_uninstall = true;
+          duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - it->second.last_touched)) {
+        uninstalled.push_back(it->first);
+        it = watches_.erase(it);
+      } else {
+        ++it;
       }
     }
-    if (auto num_buckets = watches_.bucket_count(); did_uninstall && (1 << 10) < num_buckets) {
+    if (auto num_buckets = watches_.bucket_count(); !uninstalled.empty() && (1 << 10) < num_buckets) {
       if (size_t desired_num_buckets = 1 << uint(ceil(log2(watches_.size()))); desired_num_buckets != num_buckets) {
         watches_.rehash(desired_num_buckets);
       }
     }
+    return uninstalled;
   }
 
   std::optional<Params> get_watch_params(WatchID watch_id) const {
@@ -124,6 +128,18 @@ class WatchGroup {
     }
   }
 
+  // Adds update to a single watch, returns false if the watch is not installed
+  bool update_watch(WatchID watch_id, OutputType const& obj_out) const {
+    std::shared_lock l(watches_mu_);
+    if (auto entry = watches_.find(watch_id); entry != watches_.end()) {
+      auto& watch = entry->second;
+      std::unique_lock l1(watch.mu.val);
+      watch.updates.push_back(obj_out);
+      return true;
+    }
+    return false;
+  }
+
   auto poll(WatchID watch_id) const {
     std::vector<OutputType> ret;
     std::shared_lock l(watches_mu_);
@@ -137,21 +153,60 @@ class WatchGroup {
   }
 };
 
+/**
+ * @brief Log watches that are updated through LogsDispatcher, so a new log is matched only against the filters it can
+ * match instead of all the installed ones
+ */
+class LogsWatchGroup
+    : public WatchGroup<WatchType::logs,  //
+                        std::pair<ExtendedTransactionLocation const&, TransactionReceipt const&>, LocalisedLogEntry,
+                        LogFilter> {
+  using Base = WatchGroup<WatchType::logs,  //
+                          std::pair<ExtendedTransactionLocation const&, TransactionReceipt const&>, LocalisedLogEntry,
+                          LogFilter>;
+
+  mutable LogsDispatcher dispatcher_;
+
+ public:
+  explicit LogsWatchGroup(WatchesConfig const& cfg)
+      : Base(cfg, [](auto const& log_filter, auto const& input, auto const& do_update) {
+          auto const& [trx_loc, receipt] = input;
+          log_filter.match_one(trx_loc, receipt, do_update);
+        }) {}
+
+  WatchID install_watch(LogFilter&& params) const {
+    auto filter = params;
+    auto id = Base::install_watch(std::move(params));
+    dispatcher_.add(id, std::move(filter));
+    return id;
+  }
+
+  bool uninstall_watch(WatchID watch_id) const {
+    dispatcher_.remove(watch_id);
+    return Base::uninstall_watch(watch_id);
+  }
+
+  std::vector<WatchID> uninstall_stale_watches() const {
+    auto uninstalled = Base::uninstall_stale_watches();
+    for (auto id : uninstalled) {
+      dispatcher_.remove(id);
+    }
+    return uninstalled;
+  }
+
+  void process_update(InputType const& obj_in) const {
+    auto const& [trx_loc, receipt] = obj_in;
+    dispatcher_.dispatch(trx_loc, receipt, [this](auto id, auto const& lle) { update_watch(id, lle); });
+  }
+};
+
 class Watches {
  public:
   WatchesConfig const cfg_;
 
   WatchGroup<WatchType::new_blocks, h256> const new_blocks_{cfg_};
   WatchGroup<WatchType::new_transactions, h256> const new_transactions_{cfg_};
-  WatchGroup<WatchType::logs,  //
-             std::pair<ExtendedTransactionLocation const&, TransactionReceipt const&>, LocalisedLogEntry,
-             LogFilter> const logs_{
-      cfg_,
-      [](auto const& log_filter, auto const& input, auto const& do_update) {
-        auto const& [trx_loc, receipt] = input;
-        log_filter.match_one(trx_loc, receipt, do_update);
-      },
-  };
+  LogsWatchGroup const logs_{cfg_};
 
   template <typename Visitor>
   auto visit(WatchType type, Visitor&& visitor) {
@@ -46,7 +46,6 @@ HttpProcessor::Response JsonRpcHttpProcessor::process(const Request &request) {
   }
   response.set("Access-Control-Allow-Origin", "*");
   response.set("Access-Control-Allow-Headers", "Accept, Accept-Language, Content-Language, Content-Type");
-  response.set("Connection", "close");
   response.prepare_payload();
 
   return response;
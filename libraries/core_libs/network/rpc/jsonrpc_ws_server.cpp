@@ -12,6 +12,7 @@
 #include "common/jsoncpp.hpp"
 #include "common/util.hpp"
 #include "config/config.hpp"
+#include "network/rpc/eth/Eth.h"
 
 namespace taraxa::net {
 
@@ -45,9 +46,46 @@ std::string JsonRpcWsSession::processRequest(const std::string_view &request) {
         new_dag_block_finalized_subscription_ = subscription_id_;
       } else if (params[0].asString() == "newPbftBlocks") {
         new_pbft_block_executed_subscription_ = subscription_id_;
+      } else if (params[0].asString() == "logs") {
+        if (auto ws_server = ws_server_.lock()) {
+          try {
+            std::unique_lock lock(logs_subscriptions_mtx_);
+            if (config_.max_logs_subscriptions && logs_subscriptions_.size() >= config_.max_logs_subscriptions) {
+              throw std::runtime_error("Too many logs subscriptions, limit is " +
+                                       std::to_string(config_.max_logs_subscriptions));
+            }
+            // Subscriptions of closed session would never be removed
+            if (is_closed()) {
+              throw std::runtime_error("Session is closed");
+            }
+            // Only new logs are streamed, so block range of the filter is ignored
+            const auto filter = rpc::eth::parseLogFilter(params.get(1, Json::Value(Json::objectValue)), 0);
+            logs_subscriptions_[subscription_id_] = ws_server->subscribeLogs(
+                shared_from_this(), subscription_id_, rpc::eth::LogFilter(0, {}, filter.addresses(), filter.topics()));
+          } catch (std::exception const &e) {
+            auto &res_json_error = json_response["error"] = Json::Value(Json::objectValue);
+            res_json_error["code"] = jsonrpc::Errors::ERROR_RPC_INVALID_PARAMS;
+            res_json_error["message"] = e.what();
+          }
+        }
       }
     }
-    json_response["result"] = dev::toJS(subscription_id_);
+    if (!json_response.isMember("error")) {
+      json_response["result"] = dev::toJS(subscription_id_);
+    }
+    response = util::to_string(json_response);
+    LOG(log_tr_) << "WS WRITE " << response.c_str();
+  } else if (method == "eth_unsubscribe") {
+    auto params = json.get("params", Json::Value(Json::Value(Json::arrayValue)));
+    json_response["id"] = id;
+    json_response["jsonrpc"] = "2.0";
+    bool unsubscribed = false;
+    try {
+      unsubscribed = params.size() > 0 && unsubscribe(static_cast<int>(dev::jsToInt(params[0].asString())));
+    } catch (std::exception const &e) {
+      LOG(log_er_) << "Invalid subscription id " << e.what();
+    }
+    json_response["result"] = unsubscribed;
     response = util::to_string(json_response);
     LOG(log_tr_) << "WS WRITE " << response.c_str();
   } else {
@@ -3,8 +3,8 @@
 namespace taraxa::net {
 
 HttpServer::HttpServer(boost::asio::io_context &io, boost::asio::ip::tcp::endpoint ep, const addr_t &node_addr,
-                       const std::shared_ptr<HttpProcessor> &request_processor)
-    : request_processor_(request_processor), io_context_(io), acceptor_(io), ep_(std::move(ep)) {
+                       const std::shared_ptr<HttpProcessor> &request_processor, const HttpServerConfig &config)
+    : request_processor_(request_processor), config_(config), io_context_(io), acceptor_(io), ep_(std::move(ep)) {
   LOG_OBJECTS_CREATE("HTTP");
   LOG(log_si_) << "Taraxa HttpServer started at port: " << ep_.port();
 }
@@ -44,7 +44,15 @@ void HttpServer::accept() {
   std::shared_ptr<HttpConnection> connection = createConnection();
   acceptor_.async_accept(connection->getSocket(), [this, connection](boost::system::error_code const &ec) {
     if (!ec) {
-      connection->read();
+      // Count includes the accepted connection
+      if (connections_count_ > config_.max_connections) {
+        LOG(log_wr_) << "HttpServer refused connection, max number of connections " << config_.max_connections
+                     << " reached";
+        boost::system::error_code close_ec;
+        connection->getSocket().close(close_ec);
+      } else {
+        boost::asio::dispatch(connection->getSocket().get_executor(), [connection] { connection->read(); });
+      }
     } else {
       if (stopped_) return;
 
@@ -76,21 +84,137 @@ std::shared_ptr<HttpConnection> HttpConnection::getShared() {
 }
 
 HttpConnection::HttpConnection(const std::shared_ptr<HttpServer> &http_server)
-    : server_(http_server), socket_(http_server->getIoContext()) {}
+    : server_(http_server),
+      socket_(boost::asio::make_strand(http_server->getIoContext())),
+      idle_timer_(socket_.get_executor()) {
+  server_->connections_count_++;
+}
+
+HttpConnection::~HttpConnection() { server_->connections_count_--; }
 
 void HttpConnection::read() {
+  if (reading_ || closed_ || last_request_read_ || pending_responses_.size() >= kMaxPipelinedRequests) {
+    return;
+  }
+  reading_ = true;
+  if (pending_responses_.empty()) {
+    armIdleTimer();
+  }
+  request_ = {};
   boost::beast::http::async_read(
       socket_, buffer_, request_, [this, this_sp = getShared()](boost::system::error_code const &ec, size_t) {
+        reading_ = false;
         if (ec) {
-          LOG(server_->log_er_) << "Error! HttpConnection connection read fail ... " << ec.message() << std::endl;
-        } else {
-          assert(server_->request_processor_);
-          LOG(server_->log_dg_) << "Received: " << request_;
-          response_ = server_->request_processor_->process(request_);
-          boost::beast::http::async_write(socket_, response_,
-                                          [this_sp = getShared()](auto const & /*ec*/, auto /*bytes_transfered*/) {});
+          // Client closing a persistent connection or closing of an idle connection are not errors
+          if (ec == boost::beast::http::error::end_of_stream || ec == boost::asio::error::operation_aborted) {
+            LOG(server_->log_dg_) << "HttpConnection closed: " << ec.message();
+          } else {
+            LOG(server_->log_er_) << "Error! HttpConnection connection read fail ... " << ec.message() << std::endl;
+          }
+          // Responses to already read requests are still written
+          last_request_read_ = true;
+          if (pending_responses_.empty()) {
+            close();
+          }
+          return;
         }
+        disarmIdleTimer();
+        LOG(server_->log_dg_) << "Received: " << request_;
+
+        ++requests_count_;
+        const bool keep_alive =
+            request_.keep_alive() && requests_count_ < server_->config_.max_requests_per_connection;
+        last_request_read_ = !keep_alive;
+        auto pending = std::make_shared<PendingResponse>();
+        pending_responses_.push_back(pending);
+        // Processed outside of the strand, so pipelined requests are processed concurrently
+        boost::asio::post(server_->getIoContext(), [this, this_sp, pending = std::move(pending),
+                                                    request = std::move(request_), keep_alive]() mutable {
+          process(std::move(pending), std::move(request), keep_alive);
+        });
+        read();
       });
 }
 
-}  // namespace taraxa::net
\ No newline at end of file
+void HttpConnection::process(std::shared_ptr<PendingResponse> pending, HttpProcessor::Request &&request,
+                             bool keep_alive) {
+  assert(server_->request_processor_);
+  HttpProcessor::Response response;
+  try {
+    response = server_->request_processor_->process(request);
+  } catch (std::exception const &e) {
+    LOG(server_->log_er_) << "Error! HttpConnection request processing fail ... " << e.what();
+    response = {};
+    response.result(boost::beast::http::status::internal_server_error);
+    response.prepare_payload();
+  }
+  response.version(request.version());
+  response.keep_alive(keep_alive);
+
+  boost::asio::post(socket_.get_executor(), [this, this_sp = getShared(), pending = std::move(pending),
+                                             response = std::move(response)]() mutable {
+    pending->response = std::move(response);
+    pending->ready = true;
+    write();
+  });
+}
+
+void HttpConnection::write() {
+  if (writing_ || closed_ || pending_responses_.empty() || !pending_responses_.front()->ready) {
+    return;
+  }
+  writing_ = true;
+  auto pending = pending_responses_.front();
+  boost::beast::http::async_write(
+      socket_, pending->response,
+      [this, this_sp = getShared(), pending](boost::system::error_code const &ec, size_t) {
+        writing_ = false;
+        pending_responses_.pop_front();
+        if (ec) {
+          LOG(server_->log_er_) << "Error! HttpConnection connection write fail ... " << ec.message() << std::endl;
+          close();
+          return;
+        }
+        if (pending->response.need_eof() || (last_request_read_ && pending_responses_.empty())) {
+          close();
+          return;
+        }
+        write();
+        // Reading could be paused by the limit of pipelined requests
+        read();
+        if (pending_responses_.empty() && reading_) {
+          armIdleTimer();
+        }
+      });
+}
+
+void HttpConnection::armIdleTimer() {
+  const auto generation = ++idle_timer_generation_;
+  idle_timer_.expires_after(server_->config_.idle_timeout);
+  idle_timer_.async_wait([this, this_sp = getShared(), generation](boost::system::error_code const &ec) {
+    // Expiry could be already queued when the timer was disarmed or re-armed, cancel does not abort it then
+    if (ec || generation != idle_timer_generation_) {
+      return;
+    }
+    LOG(server_->log_dg_) << "Closing idle HttpConnection";
+    close();
+  });
+}
+
+void HttpConnection::disarmIdleTimer() {
+  ++idle_timer_generation_;
+  idle_timer_.cancel();
+}
+
+void HttpConnection::close() {
+  if (closed_) {
+    return;
+  }
+  closed_ = true;
+  idle_timer_.cancel();
+  boost::system::error_code ec;
+  socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+  socket_.close(ec);
+}
+
+}  // namespace taraxa::net
@@ -19,7 +19,8 @@ DagBlockPacketHandler::DagBlockPacketHandler(const FullNodeConfig &conf, std::sh
                               std::move(pbft_chain), std::move(pbft_mgr), std::move(dag_mgr), std::move(db), node_addr,
                               "DAG_BLOCK_PH"),
       test_state_(std::move(test_state)),
-      trx_mgr_(std::move(trx_mgr)) {}
+      trx_mgr_(std::move(trx_mgr)),
+      verification_pool_(conf.network.dag_blocks_verification_threads) {}
 
 void DagBlockPacketHandler::validatePacketRlpFormat(const PacketData &packet_data) const {
   // Only one dag block can be received
@@ -49,6 +50,94 @@ void DagBlockPacketHandler::process(const PacketData &packet_data, const std::sh
   onNewBlockReceived(std::move(block), peer);
 }
 
+void DagBlockPacketHandler::startBlockVerification(const PacketData &packet_data) {
+  // Dag manager is nullptr in some unit tests
+  if (!dag_mgr_) [[unlikely]] {
+    return;
+  }
+
+  // Verification is expensive, so flood of packets can not grow the queue, in such case blocks are verified inline
+  if (verification_pool_.num_pending_tasks() >= kMaxQueuedVdfVerifications) {
+    return;
+  }
+  if (!peers_state_->getPeer(packet_data.from_node_id_)) {
+    return;
+  }
+
+  sig_t signature;
+  try {
+    validatePacketRlpFormat(packet_data);
+    signature = DagBlock::extract_signature_from_rlp(packet_data.rlp_);
+  } catch (const std::exception &e) {
+    // Invalid packet is reported once it is processed
+    return;
+  }
+
+  auto verification = std::make_shared<VdfVerification>();
+  {
+    std::unique_lock lock(vdf_verifications_mutex_);
+    if (vdf_verifications_.size() >= kMaxPendingVdfVerifications) {
+      // Only finished verifications of packets that were never processed are removed, queued work is kept
+      std::erase_if(vdf_verifications_, [](const auto &v) {
+        return v.second->result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+      });
+      if (vdf_verifications_.size() >= kMaxPendingVdfVerifications) {
+        return;
+      }
+    }
+    // Same block might be received from multiple peers
+    if (!vdf_verifications_.emplace(signature, verification).second) {
+      return;
+    }
+  }
+
+  verification_pool_.post([this, verification, block_rlp = packet_data.rlp_.data().toBytes()] {
+    // Cancelled by block processing, which verifies the block inline
+    auto queued = VdfVerification::Queued;
+    if (!verification->state.compare_exchange_strong(queued, VdfVerification::Started)) {
+      return;
+    }
+    BlockVdfVerification result{blk_hash_t{}, DagManager::VerifyBlockReturnType::AheadBlock};
+    try {
+      const DagBlock block(block_rlp);
+      if (!dag_mgr_->isDagBlockKnown(block.getHash())) {
+        result = {block.getHash(), dag_mgr_->verifyBlockVdf(block)};
+      }
+    } catch (const std::exception &e) {
+      LOG(log_dg_) << "Unable to verify dag block in advance: " << e.what();
+    }
+    verification->promise.set_value(std::move(result));
+  });
+}
+
+std::optional<DagManager::VerifyBlockReturnType> DagBlockPacketHandler::takeBlockVdfVerification(
+    const DagBlock &block) {
+  std::shared_ptr<VdfVerification> verification;
+  {
+    std::unique_lock lock(vdf_verifications_mutex_);
+    auto it = vdf_verifications_.find(block.getSig());
+    if (it == vdf_verifications_.end()) {
+      return {};
+    }
+    verification = std::move(it->second);
+    vdf_verifications_.erase(it);
+  }
+
+  // Verification that has not started yet is cancelled and block is verified inline, waiting for it could mean waiting
+  // for the whole queue of verifications ahead of it
+  auto queued = VdfVerification::Queued;
+  if (verification->state.compare_exchange_strong(queued, VdfVerification::Cancelled)) {
+    return {};
+  }
+
+  // Only successful verification of exactly the same block is reused, failures are always re-checked in verifyBlock
+  const auto &[block_hash, result] = verification->result.get();
+  if (block_hash != block.getHash() || result != DagManager::VerifyBlockReturnType::Verified) {
+    return {};
+  }
+  return result;
+}
+
 void DagBlockPacketHandler::sendBlock(dev::p2p::NodeID const &peer_id, taraxa::DagBlock block,
                                       const SharedTransactions &trxs) {
   std::shared_ptr<TaraxaPeer> peer = peers_state_->getPeer(peer_id);
@@ -97,7 +186,7 @@ void DagBlockPacketHandler::sendBlock(dev::p2p::NodeID const &peer_id, taraxa::D
 void DagBlockPacketHandler::onNewBlockReceived(DagBlock &&block, const std::shared_ptr<TaraxaPeer> &peer) {
   if (dag_mgr_) [[likely]] {
     const auto block_hash = block.getHash();
-    const auto verified = dag_mgr_->verifyBlock(block);
+    const auto verified = dag_mgr_->verifyBlock(block, takeBlockVdfVerification(block));
     switch (verified) {
       case DagManager::VerifyBlockReturnType::IncorrectTransactionsEstimation:
       case DagManager::VerifyBlockReturnType::BlockTooBig:
@@ -13,6 +13,7 @@ TransactionPacketHandler::TransactionPacketHandler(const FullNodeConfig &conf, s
                                                    std::shared_ptr<TestState> test_state, const addr_t &node_addr)
     : PacketHandler(conf, std::move(peers_state), std::move(packets_stats), node_addr, "TRANSACTION_PH"),
       trx_mgr_(std::move(trx_mgr)),
+      crypto_pool_(conf.network.transactions_verification_threads),
       test_state_(std::move(test_state)) {}
 
 void TransactionPacketHandler::validatePacketRlpFormat(const PacketData &packet_data) const {
@@ -47,58 +48,58 @@ inline void TransactionPacketHandler::process(const PacketData &packet_data, con
     trx_hashes.emplace_back(std::move(trx_hash));
   }
 
+  if (!trx_mgr_) [[unlikely]] {  // ONLY FOR TESTING
+    for (size_t tx_idx = 0; tx_idx < transaction_count; tx_idx++) {
+      onNewTransactions({std::make_shared<Transaction>(packet_data.rlp_[1][tx_idx].data().toBytes())});
+    }
+    return;
+  }
+
+  // Skip any transactions that are already known to the trx mgr
+  // Deserialization is expensive, do it only for the transactions we are about to process
+  std::vector<size_t> unknown_trx_indexes;
+  unknown_trx_indexes.reserve(transaction_count);
   for (size_t tx_idx = 0; tx_idx < transaction_count; tx_idx++) {
-    const auto &trx_hash = trx_hashes[tx_idx];
+    if (!trx_mgr_->isTransactionKnown(trx_hashes[tx_idx])) {
+      unknown_trx_indexes.push_back(tx_idx);
+    }
+  }
 
-    if (trx_mgr_) [[likely]] {  // ONLY FOR TESTING
-      // Skip any transactions that are already known to the trx mgr
-      if (trx_mgr_->isTransactionKnown(trx_hash)) {
-        continue;
+  auto transactions = recoverTransactions(packet_data, unknown_trx_indexes);
+  for (size_t i = 0; i < transactions.size(); i++) {
+    auto &transaction = transactions[i];
+    received_transactions.emplace_back(trx_hashes[unknown_trx_indexes[i]]);
+
+    TransactionStatus status;
+    std::string reason;
+    std::tie(status, reason) = trx_mgr_->verifyTransaction(transaction);
+    switch (status) {
+      case TransactionStatus::Invalid: {
+        std::ostringstream err_msg;
+        err_msg << "DagBlock transaction " << transaction->getHash() << " validation failed: " << reason;
+        throw MaliciousPeerException(err_msg.str());
       }
-
-      std::shared_ptr<Transaction> transaction;
-      // Deserialization is expensive, do it only for the transactions we are about to process
-      try {
-        transaction = std::make_shared<Transaction>(packet_data.rlp_[1][tx_idx].data().toBytes());
-        received_transactions.emplace_back(trx_hash);
-      } catch (const Transaction::InvalidSignature &e) {
-        throw MaliciousPeerException("Unable to parse transaction: " + std::string(e.what()));
-      }
-
-      TransactionStatus status;
-      std::string reason;
-      std::tie(status, reason) = trx_mgr_->verifyTransaction(transaction);
-      switch (status) {
-        case TransactionStatus::Invalid: {
+      case TransactionStatus::InsufficentBalance:
+      case TransactionStatus::LowNonce: {
+        // Raise exception in trx pool is over the limit and this peer already has too many suspicious packets
+        if (peer->reportSuspiciousPacket() && trx_mgr_->nonProposableTransactionsOverTheLimit()) {
           std::ostringstream err_msg;
-          err_msg << "DagBlock transaction " << transaction->getHash() << " validation failed: " << reason;
+          err_msg << "Suspicious packets over the limit on DagBlock transaction " << transaction->getHash()
+                  << " validation: " << reason;
           throw MaliciousPeerException(err_msg.str());
         }
-        case TransactionStatus::InsufficentBalance:
-        case TransactionStatus::LowNonce: {
-          // Raise exception in trx pool is over the limit and this peer already has too many suspicious packets
-          if (peer->reportSuspiciousPacket() && trx_mgr_->nonProposableTransactionsOverTheLimit()) {
-            std::ostringstream err_msg;
-            err_msg << "Suspicious packets over the limit on DagBlock transaction " << transaction->getHash()
-                    << " validation: " << reason;
-            throw MaliciousPeerException(err_msg.str());
-          }
-
-          break;
-        }
-        case TransactionStatus::Verified:
-          break;
-        default:
-          assert(false);
-      }
 
-      received_trx_count_++;
-      if (trx_mgr_->insertValidatedTransaction(std::move(transaction), std::move(status))) {
-        unique_received_trx_count_++;
+        break;
       }
-    } else {
-      // Only for unit tests
-      onNewTransactions({std::make_shared<Transaction>(packet_data.rlp_[1][tx_idx].data().toBytes())});
+      case TransactionStatus::Verified:
+        break;
+      default:
+        assert(false);
+    }
+
+    received_trx_count_++;
+    if (trx_mgr_->insertValidatedTransaction(std::move(transaction), std::move(status))) {
+      unique_received_trx_count_++;
     }
   }
 
@@ -109,6 +110,56 @@ inline void TransactionPacketHandler::process(const PacketData &packet_data, con
   }
 }
 
+SharedTransactions TransactionPacketHandler::recoverTransactions(const PacketData &packet_data,
+                                                                const std::vector<size_t> &trx_indexes) {
+  SharedTransactions transactions(trx_indexes.size());
+
+  const auto recover_range = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      try {
+        transactions[i] = std::make_shared<Transaction>(packet_data.rlp_[1][trx_indexes[i]].data().toBytes());
+      } catch (const Transaction::InvalidSignature &e) {
+        throw MaliciousPeerException("Unable to parse transaction: " + std::string(e.what()));
+      }
+
+      // Hash and sender are cached inside of transaction so they are not computed again on the packet thread
+      transactions[i]->getHash();
+      try {
+        transactions[i]->getSender();
+      } catch (const Transaction::InvalidSignature &) {
+        // Reported by verifyTransaction
+      }
+    }
+  };
+
+  const size_t batches_count = std::min<size_t>(kConf.network.transactions_verification_threads,
+                                                trx_indexes.size() / kMinTransactionsRecoveryBatch);
+  if (batches_count <= 1) {
+    recover_range(0, trx_indexes.size());
+  } else {
+    const size_t batch_size = (trx_indexes.size() + batches_count - 1) / batches_count;
+    crypto_pool_.parallel_for((trx_indexes.size() + batch_size - 1) / batch_size, [&](size_t batch) {
+      const auto begin = batch * batch_size;
+      recover_range(begin, std::min(begin + batch_size, trx_indexes.size()));
+    });
+  }
+
+  recovered_trx_count_ += transactions.size();
+  return transactions;
+}
+
+double TransactionPacketHandler::getRecoveredTransactionsPerSecond() {
+  std::unique_lock lock(recovery_rate_mutex_);
+  const auto now = std::chrono::steady_clock::now();
+  const auto recovered_trx_count = recovered_trx_count_.load();
+  const std::chrono::duration<double> elapsed = now - last_recovery_rate_time_;
+
+  const double rate = elapsed.count() > 0 ? (recovered_trx_count - last_recovered_trx_count_) / elapsed.count() : 0;
+  last_recovered_trx_count_ = recovered_trx_count;
+  last_recovery_rate_time_ = now;
+  return rate;
+}
+
 void TransactionPacketHandler::onNewTransactions(const SharedTransactions &transactions) {
   // Only for testing
   for (auto const &trx : transactions) {
@@ -305,7 +305,15 @@ void TaraxaCapability::interpretCapabilityPacket(std::weak_ptr<dev::p2p::Session
 
   // TODO: we are making a copy here for each packet bytes(toBytes()), which is pretty significant. Check why RLP does
   //       not support move semantics so we can take advantage of it...
-  thread_pool_->push(PacketData(packet_type, node_id, _r.data().toBytes()));
+  PacketData packet_data(packet_type, node_id, _r.data().toBytes());
+
+  // Stateless verification of dag blocks starts right away regardless of their level, processing of the packet itself
+  // is still ordered by dag level in the thread pool
+  if (packet_type == SubprotocolPacketType::DagBlockPacket) {
+    packets_handlers_->getSpecificHandler<DagBlockPacketHandler>()->startBlockVerification(packet_data);
+  }
+
+  thread_pool_->push(std::move(packet_data));
 }
 
 inline bool TaraxaCapability::filterSyncIrrelevantPackets(SubprotocolPacketType packet_type) const {
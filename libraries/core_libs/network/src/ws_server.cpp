@@ -5,6 +5,7 @@
 #include <libdevcore/CommonJS.h>
 
 #include <boost/beast/websocket/rfc6455.hpp>
+#include <unordered_set>
 
 #include "common/jsoncpp.hpp"
 #include "common/util.hpp"
@@ -13,6 +14,17 @@
 
 namespace taraxa::net {
 
+WsSession::WsSession(tcp::socket &&socket, addr_t node_addr, std::shared_ptr<WsServer> ws_server)
+    : config_(ws_server->config()), queue_stats_(ws_server->queueStats()), ws_(std::move(socket)) {
+  LOG_OBJECTS_CREATE("WS_SESSION");
+  ws_server_ = ws_server;
+}
+
+WsSession::~WsSession() {
+  queue_stats_->queued_messages -= queue_messages_.size();
+  queue_stats_->queued_bytes -= queued_bytes_;
+}
+
 void WsSession::run() {
   // Set suggested timeout settings for the websocket
   ws_.set_option(websocket::stream_base::timeout::suggested(beast::role_type::server));
@@ -65,7 +77,9 @@ void WsSession::on_read(beast::error_code ec, std::size_t bytes_transferred) {
     return close(false);
   }
 
-  boost::asio::post(executor, [this, response = std::move(response)]() mutable { writeImpl(std::move(response)); });
+  boost::asio::post(executor, [this, response = std::move(response)]() mutable {
+    writeImpl({std::make_shared<const std::string>(std::move(response)), {}});
+  });
   // Do another read
   do_read();
 }
@@ -73,8 +87,7 @@ void WsSession::on_read(beast::error_code ec, std::size_t bytes_transferred) {
 void WsSession::on_write_no_read(beast::error_code ec, std::size_t bytes_transferred) {
   LOG(log_tr_) << "WS ASYNC WRITE COMPLETE"
                << " " << &ws_;
-  // Pop on successful write
-  queue_messages_.pop();
+  writing_ = false;
   if (is_closed()) return;
 
   // For any error close the connection
@@ -89,119 +102,168 @@ void WsSession::on_write_no_read(beast::error_code ec, std::size_t bytes_transfe
   }
 }
 
-void WsSession::newEthBlock(::taraxa::final_chain::BlockHeader const &payload) {
+WsMessage SubscriptionEvent::message(int subscription_id) const {
+  if (!body_) {
+    // Keys are in the order in which jsoncpp writes them, so message is the same as serialized Json::Value
+    body_ = std::make_shared<const std::string>(R"({"jsonrpc":"2.0","method":"eth_subscription","params":{"result":)" +
+                                                util::to_string(result_fn_()) + R"(,"subscription":")");
+  }
+  return {body_, dev::toJS(subscription_id) + R"("}})", subscription_id};
+}
+
+void WsSession::notify(int subscription_id, SubscriptionEvent const &event) {
+  auto executor = ws_.get_executor();
+  if (!executor) {
+    LOG(log_tr_) << "Executor missing - WS closed";
+    return close(false);
+  }
+  boost::asio::post(executor,
+                    [this, message = event.message(subscription_id)]() mutable { writeImpl(std::move(message)); });
+}
+
+void WsSession::newEthBlock(SubscriptionEvent const &event) {
   if (new_heads_subscription_ != 0) {
-    Json::Value res, params;
-    res["jsonrpc"] = "2.0";
-    res["method"] = "eth_subscription";
-    params["result"] = rpc::eth::toJson(payload);
-    params["subscription"] = dev::toJS(new_heads_subscription_);
-    res["params"] = params;
-    auto response = util::to_string(res);
-    LOG(log_tr_) << "WS WRITE " << response.c_str();
-    auto executor = ws_.get_executor();
-    if (!executor) {
-      LOG(log_tr_) << "Executor missing - WS closed";
-      return close(false);
-    }
-    boost::asio::post(executor, [this, response = std::move(response)]() mutable { writeImpl(std::move(response)); });
+    notify(new_heads_subscription_, event);
   }
 }
 
 void WsSession::write() {
   write_buffer_ = std::move(queue_messages_.front());
+  queue_messages_.pop_front();
+  queued_bytes_ -= write_buffer_.size();
+  queue_stats_->queued_messages--;
+  queue_stats_->queued_bytes -= write_buffer_.size();
+  writing_ = true;
   ws_.text(true);  // as we are using text msg here
-  LOG(log_tr_) << "WS ASYNC WRITE " << write_buffer_.c_str() << " " << &ws_;
-  ws_.async_write(boost::asio::buffer(write_buffer_),
-                  beast::bind_front_handler(&WsSession::on_write_no_read, shared_from_this()));
+  LOG(log_tr_) << "WS ASYNC WRITE " << write_buffer_.toString() << " " << &ws_;
+  const std::array<boost::asio::const_buffer, 2> buffers{boost::asio::buffer(*write_buffer_.body),
+                                                         boost::asio::buffer(write_buffer_.tail)};
+  ws_.async_write(buffers, beast::bind_front_handler(&WsSession::on_write_no_read, shared_from_this()));
 }
 
-void WsSession::writeImpl(std::string &&message) {
-  queue_messages_.push(std::move(message));
-  if (queue_messages_.size() > 1) {
-    // outstanding async_write
-    return;
+void WsSession::writeImpl(WsMessage &&message) {
+  if (is_closed()) return;
+  queued_bytes_ += message.size();
+  queue_stats_->queued_messages++;
+  queue_stats_->queued_bytes += message.size();
+  queue_messages_.push_back(std::move(message));
+  if (!writing_) {
+    return write();
+  }
+  // Messages wait for the outstanding async_write, queue grows only if the client does not read them fast enough
+  if (queueLimitsExceeded()) {
+    applySlowConsumerPolicy();
   }
-  write();
 }
 
-void WsSession::newDagBlock(DagBlock const &blk) {
-  if (new_dag_blocks_subscription_) {
-    Json::Value res, params;
-    res["jsonrpc"] = "2.0";
-    res["method"] = "eth_subscription";
-    params["result"] = blk.getJson();
-    params["subscription"] = dev::toJS(new_dag_blocks_subscription_);
-    res["params"] = params;
-    auto response = util::to_string(res);
-    auto executor = ws_.get_executor();
-    if (!executor) {
-      LOG(log_tr_) << "Executor missing - WS closed";
-      return close(false);
+bool WsSession::queueLimitsExceeded() const {
+  return (config_.max_queue_messages && queue_messages_.size() > config_.max_queue_messages) ||
+         (config_.max_queue_bytes && queued_bytes_ > config_.max_queue_bytes);
+}
+
+void WsSession::applySlowConsumerPolicy() {
+  using Policy = WsServerConfig::SlowConsumerPolicy;
+  while (queueLimitsExceeded()) {
+    auto dropped = queue_messages_.end();
+    if (config_.slow_consumer_policy == Policy::Coalesce) {
+      // Oldest notification of a subscription that has a newer one queued
+      std::unordered_set<int> newer_subscriptions;
+      for (auto message = queue_messages_.end(); message != queue_messages_.begin();) {
+        --message;
+        if (message->subscription_id && !newer_subscriptions.insert(message->subscription_id).second) {
+          dropped = message;
+        }
+      }
     }
-    boost::asio::post(executor, [this, response = std::move(response)]() mutable { writeImpl(std::move(response)); });
+    if (dropped == queue_messages_.end() && config_.slow_consumer_policy != Policy::Disconnect) {
+      // Responses to requests are never dropped
+      dropped = std::find_if(queue_messages_.begin(), queue_messages_.end(),
+                             [](auto const &message) { return message.subscription_id != 0; });
+    }
+    if (dropped == queue_messages_.end()) {
+      LOG(log_nf_) << "WS slow consumer disconnected, queued " << queue_messages_.size() << " messages, "
+                   << queued_bytes_ << " bytes";
+      closed_ = true;
+      unsubscribeAllLogs();
+      queue_stats_->disconnected_sessions++;
+      // Outstanding write may never complete, so the socket is closed without the websocket close handshake
+      beast::get_lowest_layer(ws_).close();
+      return;
+    }
+    dropQueuedMessage(dropped);
   }
 }
 
-void WsSession::newDagBlockFinalized(blk_hash_t const &blk, uint64_t period) {
+void WsSession::dropQueuedMessage(std::deque<WsMessage>::iterator message) {
+  queued_bytes_ -= message->size();
+  queue_stats_->queued_messages--;
+  queue_stats_->queued_bytes -= message->size();
+  queue_stats_->dropped_messages++;
+  queue_messages_.erase(message);
+}
+
+void WsSession::newDagBlock(SubscriptionEvent const &event) {
+  if (new_dag_blocks_subscription_) {
+    notify(new_dag_blocks_subscription_, event);
+  }
+}
+
+void WsSession::newDagBlockFinalized(SubscriptionEvent const &event) {
   if (new_dag_block_finalized_subscription_) {
-    Json::Value res, params, result;
-    res["jsonrpc"] = "2.0";
-    res["method"] = "eth_subscription";
-    result["block"] = dev::toJS(blk);
-    result["period"] = dev::toJS(period);
-    params["result"] = result;
-    params["subscription"] = dev::toJS(new_dag_block_finalized_subscription_);
-    res["params"] = params;
-    auto response = util::to_string(res);
-    auto executor = ws_.get_executor();
-    if (!executor) {
-      LOG(log_tr_) << "Executor missing - WS closed";
-      return close(false);
-    }
-    boost::asio::post(executor, [this, response = std::move(response)]() mutable { writeImpl(std::move(response)); });
+    notify(new_dag_block_finalized_subscription_, event);
   }
 }
 
-void WsSession::newPbftBlockExecuted(Json::Value const &payload) {
+void WsSession::newPbftBlockExecuted(SubscriptionEvent const &event) {
   if (new_pbft_block_executed_subscription_) {
-    Json::Value res, params, result;
-    res["jsonrpc"] = "2.0";
-    res["method"] = "eth_subscription";
-    result["pbft_block"] = payload;
-    params["result"] = result;
-    params["subscription"] = dev::toJS(new_pbft_block_executed_subscription_);
-    res["params"] = params;
-    auto response = util::to_string(res);
-    auto executor = ws_.get_executor();
-    if (!executor) {
-      LOG(log_tr_) << "Executor missing - WS closed";
-      return close(false);
-    }
-    boost::asio::post(executor, [this, response = std::move(response)]() mutable { writeImpl(std::move(response)); });
+    notify(new_pbft_block_executed_subscription_, event);
   }
 }
 
-void WsSession::newPendingTransaction(trx_hash_t const &trx_hash) {
+void WsSession::newPendingTransaction(SubscriptionEvent const &event) {
   if (new_transactions_subscription_) {
-    Json::Value res, params;
-    res["jsonrpc"] = "2.0";
-    res["method"] = "eth_subscription";
-    params["result"] = dev::toJS(trx_hash);
-    params["subscription"] = dev::toJS(new_transactions_subscription_);
-    res["params"] = params;
-    auto response = util::to_string(res);
-    auto executor = ws_.get_executor();
-    if (!executor) {
-      LOG(log_tr_) << "Executor missing - WS closed";
-      return close(false);
+    notify(new_transactions_subscription_, event);
+  }
+}
+
+void WsSession::newLog(int subscription_id, SubscriptionEvent const &event) { notify(subscription_id, event); }
+
+bool WsSession::unsubscribe(int subscription_id) {
+  if (!subscription_id) {
+    return false;
+  }
+  std::unique_lock lock(logs_subscriptions_mtx_);
+  if (auto logs_subscription = logs_subscriptions_.find(subscription_id);
+      logs_subscription != logs_subscriptions_.end()) {
+    if (auto ws_server = ws_server_.lock()) {
+      ws_server->unsubscribeLogs(logs_subscription->second);
+    }
+    logs_subscriptions_.erase(logs_subscription);
+    return true;
+  }
+  for (auto subscription : {&new_heads_subscription_, &new_dag_blocks_subscription_, &new_transactions_subscription_,
+                            &new_dag_block_finalized_subscription_, &new_pbft_block_executed_subscription_}) {
+    if (*subscription == subscription_id) {
+      *subscription = 0;
+      return true;
     }
-    boost::asio::post(executor, [this, response = std::move(response)]() mutable { writeImpl(std::move(response)); });
   }
+  return false;
+}
+
+void WsSession::unsubscribeAllLogs() {
+  std::unique_lock lock(logs_subscriptions_mtx_);
+  if (auto ws_server = ws_server_.lock()) {
+    for (const auto &[subscription_id, id] : logs_subscriptions_) {
+      ws_server->unsubscribeLogs(id);
+    }
+  }
+  logs_subscriptions_.clear();
 }
 
 void WsSession::close(bool normal) {
   closed_ = true;
+  unsubscribeAllLogs();
   if (ws_.is_open()) {
     ws_.close(normal ? beast::websocket::normal : beast::websocket::abnormal);
   }
@@ -214,8 +276,9 @@ bool WsSession::is_normal(const beast::error_code &ec) const {
   return false;
 }
 
-WsServer::WsServer(boost::asio::io_context &ioc, tcp::endpoint endpoint, addr_t node_addr)
-    : ioc_(ioc), acceptor_(ioc), node_addr_(std::move(node_addr)) {
+WsServer::WsServer(boost::asio::io_context &ioc, tcp::endpoint endpoint, addr_t node_addr,
+                   const WsServerConfig &config)
+    : ioc_(ioc), acceptor_(ioc), node_addr_(std::move(node_addr)), config_(config) {
   LOG_OBJECTS_CREATE("WS_SERVER");
   beast::error_code ec;
 
@@ -286,6 +349,7 @@ void WsServer::on_accept(beast::error_code ec, tcp::socket socket) {
         session++;
       }
     }
+    removeClosedLogsSubscriptions();
     // Create the session and run it
     sessions.push_back(createSession(std::move(socket)));
     sessions.back()->run();
@@ -296,39 +360,121 @@ void WsServer::on_accept(beast::error_code ec, tcp::socket socket) {
 }
 
 void WsServer::newDagBlock(DagBlock const &blk) {
+  const SubscriptionEvent event([&] { return blk.getJson(); });
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   for (auto const &session : sessions) {
-    if (!session->is_closed()) session->newDagBlock(blk);
+    if (!session->is_closed()) session->newDagBlock(event);
   }
 }
 
 void WsServer::newDagBlockFinalized(blk_hash_t const &blk, uint64_t period) {
+  const SubscriptionEvent event([&] {
+    Json::Value result;
+    result["block"] = dev::toJS(blk);
+    result["period"] = dev::toJS(period);
+    return result;
+  });
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   for (auto const &session : sessions) {
-    if (!session->is_closed()) session->newDagBlockFinalized(blk, period);
+    if (!session->is_closed()) session->newDagBlockFinalized(event);
   }
 }
 
 void WsServer::newPbftBlockExecuted(PbftBlock const &pbft_blk,
                                     std::vector<blk_hash_t> const &finalized_dag_blk_hashes) {
-  auto payload = PbftBlock::toJson(pbft_blk, finalized_dag_blk_hashes);
+  const SubscriptionEvent event([&] {
+    Json::Value result;
+    result["pbft_block"] = PbftBlock::toJson(pbft_blk, finalized_dag_blk_hashes);
+    return result;
+  });
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   for (auto const &session : sessions) {
-    if (!session->is_closed()) session->newPbftBlockExecuted(payload);
+    if (!session->is_closed()) session->newPbftBlockExecuted(event);
   }
 }
 
 void WsServer::newEthBlock(::taraxa::final_chain::BlockHeader const &payload) {
+  const SubscriptionEvent event([&] { return rpc::eth::toJson(payload); });
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   for (auto const &session : sessions) {
-    if (!session->is_closed()) session->newEthBlock(payload);
+    if (!session->is_closed()) session->newEthBlock(event);
+  }
+}
+
+void WsServer::newLogs(::taraxa::final_chain::BlockHeader const &header, SharedTransactions const &trxs,
+                       ::taraxa::final_chain::TransactionReceipts const &receipts) {
+  if (!logs_dispatcher_.size()) {
+    return;
+  }
+  // Sessions are notified after the lock is released, so they can't block subscribing of other sessions
+  // Log matched by many subscriptions is serialized once, matches of the same log are reported one after another
+  std::vector<SubscriptionEvent> events;
+  std::vector<std::tuple<std::shared_ptr<WsSession>, int, size_t>> notifications;
+  {
+    std::shared_lock lock(logs_subscriptions_mtx_);
+    rpc::eth::ExtendedTransactionLocation trx_loc{{{header.number}, header.hash}};
+    for (; trx_loc.index < trxs.size(); ++trx_loc.index) {
+      trx_loc.trx_hash = trxs[trx_loc.index]->getHash();
+      std::optional<size_t> last_log;
+      logs_dispatcher_.dispatch(trx_loc, receipts[trx_loc.index], [&](auto id, auto const &lle) {
+        auto subscription = logs_subscriptions_.find(id);
+        if (subscription == logs_subscriptions_.end()) {
+          return;
+        }
+        auto session = subscription->second.session.lock();
+        if (!session || session->is_closed()) {
+          return;
+        }
+        if (last_log != lle.position_in_receipt) {
+          last_log = lle.position_in_receipt;
+          events.emplace_back([lle] { return rpc::eth::toJson(lle); });
+        }
+        notifications.emplace_back(std::move(session), subscription->second.subscription_id, events.size() - 1);
+      });
+    }
+  }
+  for (auto const &[session, subscription_id, event] : notifications) {
+    session->newLog(subscription_id, events[event]);
+  }
+}
+
+rpc::eth::LogsDispatcher::SubscriberID WsServer::subscribeLogs(std::shared_ptr<WsSession> const &session,
+                                                               int subscription_id, rpc::eth::LogFilter &&filter) {
+  std::unique_lock lock(logs_subscriptions_mtx_);
+  const auto id = ++logs_subscription_seq_;
+  logs_subscriptions_.emplace(id, LogsSubscription{session, subscription_id});
+  logs_dispatcher_.add(id, std::move(filter));
+  return id;
+}
+
+void WsServer::unsubscribeLogs(rpc::eth::LogsDispatcher::SubscriberID id) {
+  std::unique_lock lock(logs_subscriptions_mtx_);
+  logs_dispatcher_.remove(id);
+  logs_subscriptions_.erase(id);
+}
+
+size_t WsServer::numLogsSubscriptions() {
+  std::shared_lock lock(logs_subscriptions_mtx_);
+  return logs_subscriptions_.size();
+}
+
+void WsServer::removeClosedLogsSubscriptions() {
+  std::unique_lock lock(logs_subscriptions_mtx_);
+  for (auto it = logs_subscriptions_.begin(); it != logs_subscriptions_.end();) {
+    if (auto session = it->second.session.lock(); !session || session->is_closed()) {
+      logs_dispatcher_.remove(it->first);
+      it = logs_subscriptions_.erase(it);
+    } else {
+      ++it;
+    }
   }
 }
 
 void WsServer::newPendingTransaction(trx_hash_t const &trx_hash) {
+  const SubscriptionEvent event([&] { return Json::Value(dev::toJS(trx_hash)); });
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   for (auto const &session : sessions) {
-    if (!session->is_closed()) session->newPendingTransaction(trx_hash);
+    if (!session->is_closed()) session->newPendingTransaction(event);
   }
 }
 
@@ -32,6 +32,9 @@ namespace taraxa {
 namespace metrics {
 class MetricsService;
 }
+namespace net::rpc::eth {
+class LogsQueryEngine;
+}
 class Network;
 class DagBlockProposer;
 class DagManager;
@@ -79,6 +82,7 @@ class FullNode : public std::enable_shared_from_this<FullNode> {
   std::shared_ptr<net::HttpServer> graphql_http_;
   std::shared_ptr<net::WsServer> jsonrpc_ws_;
   std::shared_ptr<net::WsServer> graphql_ws_;
+  std::shared_ptr<net::rpc::eth::LogsQueryEngine> logs_query_engine_;
   std::unique_ptr<jsonrpc_server_t> jsonrpc_api_;
   std::unique_ptr<metrics::MetricsService> metrics_;
 
@@ -14,9 +14,12 @@
 #include "graphql/http_processor.hpp"
 #include "graphql/ws_server.hpp"
 #include "key_manager/key_manager.hpp"
+#include "metrics/db_metrics.hpp"
+#include "metrics/final_chain_metrics.hpp"
 #include "metrics/metrics_service.hpp"
 #include "metrics/network_metrics.hpp"
 #include "metrics/pbft_metrics.hpp"
+#include "metrics/rpc_metrics.hpp"
 #include "metrics/transaction_queue_metrics.hpp"
 #include "network/rpc/Net.h"
 #include "network/rpc/Taraxa.h"
@@ -24,12 +27,42 @@
 #include "network/rpc/eth/Eth.h"
 #include "network/rpc/jsonrpc_http_processor.hpp"
 #include "network/rpc/jsonrpc_ws_server.hpp"
+#include "network/tarcap/packets_handlers/transaction_packet_handler.hpp"
 #include "pbft/pbft_manager.hpp"
 #include "transaction/gas_pricer.hpp"
 #include "transaction/transaction_manager.hpp"
 
 namespace taraxa {
 
+static net::HttpServerConfig httpServerConfig(const ConnectionConfig &config) {
+  net::HttpServerConfig http_config;
+  http_config.idle_timeout = std::chrono::seconds(config.http_idle_timeout);
+  http_config.max_requests_per_connection = config.http_max_requests_per_connection;
+  http_config.max_connections = config.http_max_connections;
+  return http_config;
+}
+
+static net::rpc::eth::LogsQueryConfig logsQueryConfig(const ConnectionConfig &config) {
+  net::rpc::eth::LogsQueryConfig logs_config;
+  logs_config.max_block_range = config.logs_max_block_range;
+  logs_config.max_results = config.logs_max_results;
+  logs_config.threads = config.logs_query_threads;
+  return logs_config;
+}
+
+static net::WsServerConfig wsServerConfig(const ConnectionConfig &config) {
+  net::WsServerConfig ws_config;
+  ws_config.max_queue_messages = config.ws_max_queue_messages;
+  ws_config.max_queue_bytes = config.ws_max_queue_bytes;
+  ws_config.max_logs_subscriptions = config.ws_max_logs_subscriptions;
+  if (config.ws_slow_consumer_policy == ConnectionConfig::kWsCoalesce) {
+    ws_config.slow_consumer_policy = net::WsServerConfig::SlowConsumerPolicy::Coalesce;
+  } else if (config.ws_slow_consumer_policy == ConnectionConfig::kWsDisconnect) {
+    ws_config.slow_consumer_policy = net::WsServerConfig::SlowConsumerPolicy::Disconnect;
+  }
+  return ws_config;
+}
+
 FullNode::FullNode(FullNodeConfig const &conf) : subscription_pool_(1), conf_(conf), kp_(conf_.node_secret) { init(); }
 
 FullNode::~FullNode() { close(); }
@@ -59,13 +92,14 @@ void FullNode::init() {
     if (conf_.db_config.rebuild_db) {
       old_db_ = std::make_shared<DbStorage>(conf_.db_path, conf_.db_config.db_snapshot_each_n_pbft_block,
                                             conf_.db_config.db_max_open_files, conf_.db_config.db_max_snapshots,
-                                            conf_.db_config.db_revert_to_period, node_addr, true);
+                                            conf_.db_config.db_revert_to_period, node_addr, true, false,
+                                            conf_.db_config.columns);
     }
 
     db_ = std::make_shared<DbStorage>(conf_.db_path, conf_.db_config.db_snapshot_each_n_pbft_block,
                                       conf_.db_config.db_max_open_files, conf_.db_config.db_max_snapshots,
                                       conf_.db_config.db_revert_to_period, node_addr, false,
-                                      conf_.db_config.rebuild_db_columns);
+                                      conf_.db_config.rebuild_db_columns, conf_.db_config.columns);
 
     if (db_->hasMinorVersionChanged()) {
       LOG(log_si_) << "Minor DB version has changed. Rebuilding Db";
@@ -73,15 +107,21 @@ void FullNode::init() {
       db_ = nullptr;
       old_db_ = std::make_shared<DbStorage>(conf_.db_path, conf_.db_config.db_snapshot_each_n_pbft_block,
                                             conf_.db_config.db_max_open_files, conf_.db_config.db_max_snapshots,
-                                            conf_.db_config.db_revert_to_period, node_addr, true);
+                                            conf_.db_config.db_revert_to_period, node_addr, true, false,
+                                            conf_.db_config.columns);
       db_ = std::make_shared<DbStorage>(conf_.db_path, conf_.db_config.db_snapshot_each_n_pbft_block,
                                         conf_.db_config.db_max_open_files, conf_.db_config.db_max_snapshots,
-                                        conf_.db_config.db_revert_to_period, node_addr);
+                                        conf_.db_config.db_revert_to_period, node_addr, false, false,
+                                        conf_.db_config.columns);
     }
     if (db_->getNumDagBlocks() == 0) {
       db_->saveDagBlock(conf_.genesis.dag_genesis_block);
       db_->setGenesisHash(conf_.genesis.genesisHash());
     }
+    db_->setGroupCommitWindow(conf_.db_config.group_commit_window);
+    if (conf_.is_light_node) {
+      db_->startHistoryPruning(uint64_t(conf_.db_config.history_pruning_rate_limit) << 20);
+    }
   }
   LOG(log_nf_) << "DB initialized ...";
 
@@ -137,6 +177,10 @@ void FullNode::setupMetricsUpdaters() {
   network_metrics->setPeersCountUpdater([network = network_]() { return network->getPeerCount(); });
   network_metrics->setDiscoveredPeersCountUpdater([network = network_]() { return network->getNodeCount(); });
   network_metrics->setSyncingDurationUpdater([network = network_]() { return network->syncTimeSeconds(); });
+  network_metrics->setRecoveredTransactionsPerSecondUpdater(
+      [trx_packet_handler = network_->getSpecificHandler<network::tarcap::TransactionPacketHandler>()]() {
+        return trx_packet_handler->getRecoveredTransactionsPerSecond();
+      });
 
   auto transaction_queue_metrics = metrics_->getMetrics<metrics::TransactionQueueMetrics>();
   transaction_queue_metrics->setTransactionsCountUpdater(
@@ -150,6 +194,39 @@ void FullNode::setupMetricsUpdaters() {
   pbft_metrics->setStepUpdater([pbft_mgr = pbft_mgr_]() { return pbft_mgr->getPbftStep(); });
   pbft_metrics->setVotesCountUpdater(
       [pbft_mgr = pbft_mgr_]() { return pbft_mgr->getCurrentNodeVotesCount().value_or(0); });
+  auto db_metrics = metrics_->getMetrics<metrics::DbMetrics>();
+  db_metrics->setGroupCommitSyncsUpdater([db = db_]() { return db->getGroupCommitStats().syncs; });
+  db_metrics->setGroupCommitBatchesUpdater([db = db_]() { return db->getGroupCommitStats().batches; });
+  db_metrics->setGroupCommitLastBatchesUpdater([db = db_]() { return db->getGroupCommitStats().last_batches; });
+  db_metrics->setWalSyncLatencyTotalUpdater([db = db_]() { return db->getGroupCommitStats().sync_latency_us; });
+  db_metrics->setWalLastSyncLatencyUpdater([db = db_]() { return db->getGroupCommitStats().last_sync_latency_us; });
+  auto final_chain_metrics = metrics_->getMetrics<metrics::FinalChainMetrics>();
+  final_chain_metrics->setCacheHitsUpdater([final_chain = final_chain_]() { return final_chain->cache_stats().hits; });
+  final_chain_metrics->setCacheMissesUpdater(
+      [final_chain = final_chain_]() { return final_chain->cache_stats().misses; });
+  final_chain_metrics->setCacheSizeUpdater([final_chain = final_chain_]() { return final_chain->cache_stats().size; });
+  final_chain_metrics->setCacheEntriesUpdater(
+      [final_chain = final_chain_]() { return final_chain->cache_stats().entries; });
+  if (logs_query_engine_) {
+    auto rpc_metrics = metrics_->getMetrics<metrics::RpcMetrics>();
+    rpc_metrics->setLogsQueriesUpdater([engine = logs_query_engine_]() { return engine->stats().queries; });
+    rpc_metrics->setLogsRejectedQueriesUpdater(
+        [engine = logs_query_engine_]() { return engine->stats().rejected_queries; });
+    rpc_metrics->setLogsQueriesLatencyTotalUpdater(
+        [engine = logs_query_engine_]() { return engine->stats().latency_total_us; });
+    rpc_metrics->setLogsLastQueryLatencyUpdater(
+        [engine = logs_query_engine_]() { return engine->stats().last_latency_us; });
+  }
+  if (jsonrpc_ws_) {
+    auto rpc_metrics = metrics_->getMetrics<metrics::RpcMetrics>();
+    const auto &ws_stats = jsonrpc_ws_->queueStats();
+    rpc_metrics->setWsQueuedMessagesUpdater([ws_stats]() { return ws_stats->queued_messages.load(); });
+    rpc_metrics->setWsQueuedBytesUpdater([ws_stats]() { return ws_stats->queued_bytes.load(); });
+    rpc_metrics->setWsDroppedMessagesUpdater([ws_stats]() { return ws_stats->dropped_messages.load(); });
+    rpc_metrics->setWsDisconnectedSlowConsumersUpdater(
+        [ws_stats]() { return ws_stats->disconnected_sessions.load(); });
+  }
+
   final_chain_->block_finalized_.subscribe([pbft_metrics](const std::shared_ptr<final_chain::FinalizationResult> &res) {
     pbft_metrics->setBlockNumber(res->final_chain_blk->number);
     pbft_metrics->setBlockTransactionsCount(res->trxs.size());
@@ -170,6 +247,8 @@ void FullNode::start() {
     eth_rpc_params.chain_id = conf_.genesis.chain_id;
     eth_rpc_params.gas_limit = conf_.genesis.dag.gas_limit;
     eth_rpc_params.final_chain = final_chain_;
+    logs_query_engine_ = std::make_shared<net::rpc::eth::LogsQueryEngine>(logsQueryConfig(*conf_.network.rpc));
+    eth_rpc_params.logs_query_engine = logs_query_engine_;
     eth_rpc_params.gas_pricer = [gas_pricer = gas_pricer_]() { return gas_pricer->bid(); };
     eth_rpc_params.get_trx = [db = db_](auto const &trx_hash) { return db->getTransaction(trx_hash); };
     eth_rpc_params.send_trx = [trx_manager = trx_mgr_](auto const &trx) {
@@ -213,14 +292,15 @@ void FullNode::start() {
       jsonrpc_http_ = std::make_shared<net::HttpServer>(
           rpc_thread_pool_->unsafe_get_io_context(),
           boost::asio::ip::tcp::endpoint{conf_.network.rpc->address, *conf_.network.rpc->http_port}, getAddress(),
-          json_rpc_processor);
+          json_rpc_processor, httpServerConfig(*conf_.network.rpc));
       jsonrpc_api_->addConnector(json_rpc_processor);
       jsonrpc_http_->start();
     }
     if (conf_.network.rpc->ws_port) {
       jsonrpc_ws_ = std::make_shared<net::JsonRpcWsServer>(
           rpc_thread_pool_->unsafe_get_io_context(),
-          boost::asio::ip::tcp::endpoint{conf_.network.rpc->address, *conf_.network.rpc->ws_port}, getAddress());
+          boost::asio::ip::tcp::endpoint{conf_.network.rpc->address, *conf_.network.rpc->ws_port}, getAddress(),
+          wsServerConfig(*conf_.network.rpc));
       jsonrpc_api_->addConnector(jsonrpc_ws_);
       jsonrpc_ws_->run();
     }
@@ -231,6 +311,7 @@ void FullNode::start() {
           }
           if (auto _ws = ws.lock()) {
             _ws->newEthBlock(*res->final_chain_blk);
+            _ws->newLogs(*res->final_chain_blk, res->trxs, res->trx_receipts);
             if (auto _db = db.lock()) {
               auto pbft_blk = _db->getPbftBlock(res->hash);
               if (const auto &hash = pbft_blk->getPivotDagBlockHash(); hash != kNullBlockHash) {
@@ -276,7 +357,8 @@ void FullNode::start() {
           boost::asio::ip::tcp::endpoint{conf_.network.graphql->address, *conf_.network.graphql->http_port},
           getAddress(),
           std::make_shared<net::GraphQlHttpProcessor>(final_chain_, dag_mgr_, pbft_mgr_, trx_mgr_, db_, gas_pricer_,
-                                                      as_weak(network_), conf_.genesis.chain_id));
+                                                      as_weak(network_), conf_.genesis.chain_id),
+          httpServerConfig(*conf_.network.graphql));
       graphql_http_->start();
     }
   }
@@ -294,6 +376,7 @@ void FullNode::start() {
       [trx_manager = as_weak(trx_mgr_)](auto const &res) {
         if (auto trx_mgr = trx_manager.lock()) {
           trx_mgr->blockFinalized(res->final_chain_blk->number);
+          trx_mgr->updateLatestAccounts(*res);
         }
       },
       subscription_pool_);
@@ -2,14 +2,22 @@
 
 #include <rocksdb/db.h>
 #include <rocksdb/options.h>
+#include <rocksdb/rate_limiter.h>
 #include <rocksdb/slice.h>
 #include <rocksdb/write_batch.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <functional>
+#include <numeric>
 #include <string_view>
+#include <thread>
 
 #include "common/types.hpp"
+#include "config/db_config.hpp"
 #include "dag/dag_block.hpp"
 #include "logger/logger.hpp"
 #include "pbft/pbft_block.hpp"
@@ -29,7 +37,12 @@ enum StatusDbField : uint8_t {
   DagBlkCount,
   DagEdgeCount,
   DbMajorVersion,
-  DbMinorVersion
+  DbMinorVersion,
+  PeriodDataMigrated,
+  HistoryPruningTarget,  // History of all periods before this one is scheduled to be deleted
+  HistoryPrunedPeriod,   // History of all periods before this one is already deleted
+  BlockReceiptsMigrated,
+  PeriodDataMigratedPeriod  // Period data of all periods before this one is already migrated
 };
 
 enum class PbftMgrField : uint8_t { Round = 0, Step };
@@ -69,11 +82,18 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
    public:
     size_t const ordinal_;
     const rocksdb::Comparator* comparator_;
+    // Name of the DbColumnsConfig profile used for tuning of the column, can be overridden in config
+    string const profile_;
 
-    Column(string name, size_t ordinal, const rocksdb::Comparator* comparator)
-        : name_(std::move(name)), ordinal_(ordinal), comparator_(comparator) {}
+    Column(string name, size_t ordinal, const rocksdb::Comparator* comparator,
+           string profile = DbColumnsConfig::kDefaultProfile)
+        : name_(std::move(name)), ordinal_(ordinal), comparator_(comparator), profile_(std::move(profile)) {}
 
-    Column(string name, size_t ordinal) : name_(std::move(name)), ordinal_(ordinal), comparator_(nullptr) {}
+    Column(string name, size_t ordinal)
+        : name_(std::move(name)),
+          ordinal_(ordinal),
+          comparator_(nullptr),
+          profile_(DbColumnsConfig::kDefaultProfile) {}
 
     auto const& name() const { return ordinal_ ? name_ : rocksdb::kDefaultColumnFamilyName; }
   };
@@ -87,16 +107,23 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
 #define COLUMN(__name__) static inline auto const __name__ = all_.emplace_back(#__name__, all_.size())
 #define COLUMN_W_COMP(__name__, ...) \
   static inline auto const __name__ = all_.emplace_back(#__name__, all_.size(), __VA_ARGS__)
+#define COLUMN_W_PROFILE(__name__, __profile__) \
+  static inline auto const __name__ = all_.emplace_back(#__name__, all_.size(), nullptr, __profile__)
 
     // do not change/move
     COLUMN(default_column);
     // Contains full data for an executed PBFT block including PBFT block, cert votes, dag blocks and transactions
-    COLUMN_W_COMP(period_data, getIntComparator<uint64_t>());
+    // Pbft block + cert votes
+    COLUMN_W_COMP(period_data, getIntComparator<uint64_t>(), DbColumnsConfig::kSequentialProfile);
+    // Finalized dag blocks by (period, position)
+    COLUMN_W_PROFILE(period_dag_blocks, DbColumnsConfig::kPeriodEntriesProfile);
+    // Finalized transactions by (period, position)
+    COLUMN_W_PROFILE(period_transactions, DbColumnsConfig::kPeriodEntriesProfile);
     COLUMN(genesis);
-    COLUMN(dag_blocks);
+    COLUMN_W_PROFILE(dag_blocks, DbColumnsConfig::kPointLookupProfile);
     COLUMN(dag_blocks_index);
-    COLUMN(transactions);
-    COLUMN(trx_period);
+    COLUMN_W_PROFILE(transactions, DbColumnsConfig::kPointLookupProfile);
+    COLUMN_W_PROFILE(trx_period, DbColumnsConfig::kPointLookupProfile);
     COLUMN(status);
     COLUMN(pbft_mgr_round_step);
     COLUMN(pbft_period_2t_plus_1);
@@ -108,23 +135,27 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
     COLUMN(verified_votes);
     COLUMN(next_votes);             // only for previous PBFT round
     COLUMN(last_block_cert_votes);  // cert votes for last block in pbft chain
-    COLUMN(pbft_block_period);
-    COLUMN(dag_block_period);
+    COLUMN_W_PROFILE(pbft_block_period, DbColumnsConfig::kPointLookupProfile);
+    COLUMN_W_PROFILE(dag_block_period, DbColumnsConfig::kPointLookupProfile);
     COLUMN_W_COMP(proposal_period_levels_map, getIntComparator<uint64_t>());
     COLUMN(final_chain_meta);
-    COLUMN(final_chain_transaction_location_by_hash);
+    COLUMN_W_PROFILE(final_chain_transaction_location_by_hash, DbColumnsConfig::kPointLookupProfile);
     COLUMN(final_chain_replay_protection);
     COLUMN(final_chain_transaction_hashes_by_blk_number);
     COLUMN(final_chain_transaction_count_by_blk_number);
     COLUMN(final_chain_blk_by_number);
     COLUMN(final_chain_blk_hash_by_number);
-    COLUMN(final_chain_blk_number_by_hash);
-    COLUMN(final_chain_receipt_by_trx_hash);
+    COLUMN_W_PROFILE(final_chain_blk_number_by_hash, DbColumnsConfig::kPointLookupProfile);
+    COLUMN_W_PROFILE(final_chain_receipt_by_trx_hash, DbColumnsConfig::kPointLookupProfile);
+    // Rlp list of receipts of all the block transactions, so logs of a block are read by a single lookup
+    COLUMN_W_COMP(final_chain_receipts_by_blk_number, getIntComparator<uint64_t>(),
+                  DbColumnsConfig::kSequentialProfile);
     COLUMN(final_chain_log_blooms_index);
     COLUMN_W_COMP(sortition_params_change, getIntComparator<uint64_t>());
 
 #undef COLUMN
 #undef COLUMN_W_COMP
+#undef COLUMN_W_PROFILE
   };
 
  private:
@@ -147,14 +178,111 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
 
   bool minor_version_changed_ = false;
 
+  // Background migration of receipts to final_chain_receipts_by_blk_number column
+  std::thread block_receipts_migration_worker_;
+  std::atomic<bool> stop_block_receipts_migration_ = false;
+
+  // Background deletion of history scheduled by clearPeriodDataHistory
+  std::thread history_pruning_worker_;
+  std::mutex history_pruning_mutex_;
+  std::condition_variable history_pruning_cv_;
+  bool stop_history_pruning_ = false;
+  PbftPeriod history_pruning_target_ = 0;
+  PbftPeriod history_pruned_period_ = 0;
+  std::unique_ptr<rocksdb::RateLimiter> history_pruning_rate_limiter_;
+  // Cancels running manual compaction of the pruned history on shutdown
+  std::atomic<bool> history_compaction_canceled_ = false;
+  // Following members are accessed only by the pruning worker
+  PbftPeriod history_compacted_period_ = 0;
+  uint64_t history_deleted_keys_ = 0;
+
+  // Sync batches waiting for the group commit writer
+  struct PendingCommit {
+    Batch batch;
+    std::function<void(rocksdb::Status const&)> on_committed;
+  };
+  std::deque<PendingCommit> group_commit_queue_;
+  std::mutex group_commit_mutex_;
+  std::condition_variable group_commit_cv_;
+  bool stop_group_commit_ = false;
+  std::atomic<uint32_t> group_commit_window_us_ = kDefaultGroupCommitWindowUs;
+  std::atomic<uint64_t> group_commit_syncs_ = 0;
+  std::atomic<uint64_t> group_commit_batches_ = 0;
+  std::atomic<uint64_t> group_commit_last_batches_ = 0;
+  std::atomic<uint64_t> group_commit_sync_latency_us_ = 0;
+  std::atomic<uint64_t> group_commit_last_sync_latency_us_ = 0;
+  std::thread group_commit_worker_;
+
   auto handle(Column const& col) const { return handles_[col.ordinal_]; }
 
+  /**
+   * @brief Creates options of column family according to the profile the column is using
+   */
+  static rocksdb::ColumnFamilyOptions makeColumnOptions(
+      Column const& col, DbColumnsConfig const& config,
+      std::map<std::string, std::shared_ptr<rocksdb::Cache>>& profile_block_caches);
+
+  /**
+   * @brief Creates key of period_dag_blocks and period_transactions columns. It is big endian, so entries are ordered
+   *        by period and position within the period
+   */
+  static dev::bytes toPeriodPositionKey(PbftPeriod period, uint32_t position);
+
+  /**
+   * @brief Gets raw entries of all positions in the period from period_dag_blocks or period_transactions column
+   */
+  std::vector<std::string> getPeriodEntries(PbftPeriod period, Column const& column) const;
+
+  /**
+   * @brief Moves dag blocks and transactions of periods stored in the previous layout (whole period data in one
+   *        period_data entry) to period_dag_blocks and period_transactions columns
+   */
+  void migratePeriodData();
+
+  /**
+   * @brief Fills final_chain_receipts_by_blk_number column for blocks finalized before it was introduced, receipts are
+   *        taken from final_chain_receipt_by_trx_hash column. Runs on block_receipts_migration_worker_ and is resumed
+   *        after restart until it is finished
+   */
+  void migrateBlockReceipts();
+
+  /**
+   * @brief Main loop of the group commit writer. Writes all the pending sync batches and syncs WAL once for all of them
+   */
+  void groupCommit();
+
+  /**
+   * @brief Starts the history pruning worker if it is not running yet
+   */
+  void startHistoryPruningWorker();
+
+  /**
+   * @brief Main loop of the history pruning worker
+   */
+  void pruneHistory();
+
+  /**
+   * @brief Deletes history of next chunk of periods and persists the progress in the same batch
+   * @return false if there is nothing to delete
+   */
+  bool pruneHistoryChunk();
+
+  /**
+   * @brief Compacts already deleted history. It is deferred until all the scheduled history is deleted, hash keyed
+   *        columns are compacted only after a significant amount of keys were deleted from them
+   */
+  void compactPrunedHistory();
+
   LOG_OBJECTS_DEFINE
 
  public:
+  static constexpr uint64_t kDefaultHistoryPruningRateLimit = 16 << 20;
+  static constexpr uint32_t kDefaultGroupCommitWindowUs = 200;
+
   explicit DbStorage(fs::path const& base_path, uint32_t db_snapshot_each_n_pbft_block = 0, uint32_t max_open_files = 0,
                      uint32_t db_max_snapshots = 0, PbftPeriod db_revert_to_period = 0, addr_t node_addr = addr_t(),
-                     bool rebuild = false, bool rebuild_columns = false);
+                     bool rebuild = false, bool rebuild_columns = false,
+                     DbColumnsConfig const& columns_config = DbColumnsConfig());
   ~DbStorage();
 
   DbStorage(const DbStorage&) = delete;
@@ -166,6 +294,10 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
   auto dbStoragePath() const { return db_path_; }
   auto stateDbStoragePath() const { return state_db_path_; }
   static Batch createWriteBatch();
+  /**
+   * @brief Commits the batch. Batches with sync option are committed by the group commit writer and the call blocks
+   *        until the batch is durable
+   */
   void commitWriteBatch(Batch& write_batch, rocksdb::WriteOptions const& opts);
   void commitWriteBatch(Batch& write_batch) { commitWriteBatch(write_batch, write_options_); }
 
@@ -183,7 +315,45 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
 
   // Period data
   void savePeriodData(const PeriodData& period_data, Batch& write_batch);
-  void clearPeriodDataHistory(PbftPeriod period);
+  /**
+   * @brief Schedules deletion of period data and related final chain data of all periods before end_period. Deletion
+   *        is done by background worker in small rate limited chunks, so the call does not block
+   */
+  void clearPeriodDataHistory(PbftPeriod end_period);
+
+  /**
+   * @brief Starts background worker deleting history scheduled by clearPeriodDataHistory or updates its rate limit if
+   *        it is already running. Worker is started automatically if there is unfinished deletion from previous run
+   * @param rate_limit max number of bytes per second read and written by the worker
+   */
+  void startHistoryPruning(uint64_t rate_limit = kDefaultHistoryPruningRateLimit);
+  void stopHistoryPruning();
+
+  /**
+   * @brief Commits the batch durably by the group commit writer. Sync batches committed within the group commit window
+   *        are written together and made durable by a single WAL sync. Batch is visible to reads once it is written,
+   *        which may be shortly before it is durable
+   * @param on_committed called from the writer thread once the batch is durable or it failed to be written, it must
+   *        not block
+   */
+  void commitWriteBatchAsync(Batch&& write_batch, std::function<void(rocksdb::Status const&)> on_committed);
+
+  /**
+   * @brief Sets how long the group commit writer waits for more sync batches after the first one arrives
+   */
+  void setGroupCommitWindow(uint32_t window_us) { group_commit_window_us_ = window_us; }
+
+  struct GroupCommitStats {
+    uint64_t syncs = 0;
+    uint64_t batches = 0;
+    uint64_t last_batches = 0;
+    uint64_t sync_latency_us = 0;
+    uint64_t last_sync_latency_us = 0;
+  };
+  /**
+   * @brief Group commit statistics, batches and sync latency are cumulative since start, last_* are of the last sync
+   */
+  GroupCommitStats getGroupCommitStats() const;
   dev::bytes getPeriodDataRaw(PbftPeriod period) const;
   std::optional<PbftBlock> getPbftBlock(PbftPeriod period) const;
   blk_hash_t getPeriodBlockHash(PbftPeriod period) const;
@@ -229,6 +399,8 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
   void saveTransactionPeriod(trx_hash_t const& trx, PbftPeriod period, uint32_t position);
   void addTransactionPeriodToBatch(Batch& write_batch, trx_hash_t const& trx, PbftPeriod period, uint32_t position);
   std::optional<std::pair<PbftPeriod, uint32_t>> getTransactionPeriod(trx_hash_t const& hash) const;
+  std::vector<std::optional<std::pair<PbftPeriod, uint32_t>>> getTransactionsPeriod(
+      std::vector<trx_hash_t> const& hashes) const;
   std::unordered_map<trx_hash_t, PbftPeriod> getAllTransactionPeriod();
 
   // PBFT manager
@@ -368,6 +540,63 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
     return value;
   }
 
+  /**
+   * @brief Batched lookup of multiple keys in column with single MultiGet call. Keys are sorted by column comparator
+   *        before the lookup, so rocksdb can process them in one pass
+   *
+   * @param keys
+   * @param column
+   * @return values in the same order as keys, empty string for keys which are not in db
+   */
+  template <typename K>
+  std::vector<std::string> multiLookup(std::vector<K> const& keys, Column const& column) const {
+    std::vector<std::string> ret(keys.size());
+    if (keys.empty()) {
+      return ret;
+    }
+
+    const auto* comparator = column.comparator_ ? column.comparator_ : rocksdb::BytewiseComparator();
+    std::vector<Slice> key_slices;
+    key_slices.reserve(keys.size());
+    for (auto const& key : keys) {
+      key_slices.emplace_back(toSlice(key));
+    }
+    std::vector<size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      return comparator->Compare(key_slices[a], key_slices[b]) < 0;
+    });
+    std::vector<Slice> sorted_key_slices;
+    sorted_key_slices.reserve(keys.size());
+    for (const auto i : order) {
+      sorted_key_slices.emplace_back(key_slices[i]);
+    }
+
+    std::vector<rocksdb::PinnableSlice> values(keys.size());
+    std::vector<rocksdb::Status> statuses(keys.size());
+    db_->MultiGet(read_options_, handle(column), keys.size(), sorted_key_slices.data(), values.data(),
+                  statuses.data(), true);
+    for (size_t i = 0; i < order.size(); i++) {
+      if (statuses[i].IsNotFound()) {
+        continue;
+      }
+      checkStatus(statuses[i]);
+      ret[order[i]] = values[i].ToString();
+    }
+    return ret;
+  }
+
+  /**
+   * @brief Batched version of exist
+   */
+  template <typename K>
+  std::vector<bool> multiExist(std::vector<K> const& keys, Column const& column) const {
+    const auto values = multiLookup(keys, column);
+    std::vector<bool> ret(values.size());
+    std::transform(values.begin(), values.end(), ret.begin(), [](const auto& value) { return !value.empty(); });
+    return ret;
+  }
+
   template <typename Int, typename K>
   auto lookup_int(K const& key, Column const& column) -> std::enable_if_t<std::is_integral_v<Int>, std::optional<Int>> {
     auto str = lookup(key, column);
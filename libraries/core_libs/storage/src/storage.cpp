@@ -2,10 +2,15 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/split.hpp>
+#include <future>
 #include <memory>
 
 #include "config/version.hpp"
 #include "dag/sortition_params_manager.hpp"
+#include "rocksdb/cache.h"
+#include "rocksdb/filter_policy.h"
+#include "rocksdb/slice_transform.h"
+#include "rocksdb/table.h"
 #include "rocksdb/utilities/checkpoint.h"
 #include "storage/uint_comparator.hpp"
 #include "vote/vote.hpp"
@@ -17,10 +22,21 @@ static constexpr uint16_t PBFT_BLOCK_POS_IN_PERIOD_DATA = 0;
 static constexpr uint16_t CERT_VOTES_POS_IN_PERIOD_DATA = 1;
 static constexpr uint16_t DAG_BLOCKS_POS_IN_PERIOD_DATA = 2;
 static constexpr uint16_t TRANSACTIONS_POS_IN_PERIOD_DATA = 3;
+// Only pbft block and cert votes are stored in period_data column, dag blocks and transactions are stored separately
+static constexpr uint16_t STORED_PERIOD_DATA_ITEM_COUNT = 2;
+static constexpr uint32_t PERIOD_DATA_MIGRATION_BATCH_SIZE = 1000;
+// Major db version which stored dag blocks and transactions inside of period_data, it is migrated by migratePeriodData
+static constexpr uint32_t kPeriodDataMigrationDbMajorVersion = 1;
+// Number of periods deleted by the history pruning worker in a single batch
+static constexpr uint32_t HISTORY_PRUNING_CHUNK_SIZE = 100;
+// Number of keys deleted from hash keyed columns after which the columns are compacted to free the disk space
+static constexpr uint64_t HISTORY_PRUNING_COMPACTION_THRESHOLD = 1000000;
+// Group commit writer does not wait for more batches once it has this many
+static constexpr size_t GROUP_COMMIT_MAX_BATCHES = 64;
 
 DbStorage::DbStorage(fs::path const& path, uint32_t db_snapshot_each_n_pbft_block, uint32_t max_open_files,
                      uint32_t db_max_snapshots, PbftPeriod db_revert_to_period, addr_t node_addr, bool rebuild,
-                     bool rebuild_columns)
+                     bool rebuild_columns, DbColumnsConfig const& columns_config)
     : path_(path),
       handles_(Columns::all.size()),
       kDbSnapshotsEachNblock(db_snapshot_each_n_pbft_block),
@@ -51,12 +67,15 @@ DbStorage::DbStorage(fs::path const& path, uint32_t db_snapshot_each_n_pbft_bloc
   // aleth default 256 (state_db is using another 128)
   options.max_open_files = (max_open_files) ? max_open_files : 256;
 
+  // Columns with prefix extractor would otherwise iterate only within the prefix of the seek key
+  read_options_.total_order_seek = true;
+
+  // Columns using the same profile share one block cache
+  std::map<std::string, std::shared_ptr<rocksdb::Cache>> profile_block_caches;
   std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
   descriptors.reserve(Columns::all.size());
-  std::transform(Columns::all.begin(), Columns::all.end(), std::back_inserter(descriptors), [](const Column& col) {
-    auto options = rocksdb::ColumnFamilyOptions();
-    if (col.comparator_) options.comparator = col.comparator_;
-    return rocksdb::ColumnFamilyDescriptor(col.name(), options);
+  std::transform(Columns::all.begin(), Columns::all.end(), std::back_inserter(descriptors), [&](const Column& col) {
+    return rocksdb::ColumnFamilyDescriptor(col.name(), makeColumnOptions(col, columns_config, profile_block_caches));
   });
   LOG_OBJECTS_CREATE("DBS");
 
@@ -85,7 +104,14 @@ DbStorage::DbStorage(fs::path const& path, uint32_t db_snapshot_each_n_pbft_bloc
     saveStatusField(StatusDbField::DbMajorVersion, TARAXA_DB_MAJOR_VERSION);
     saveStatusField(StatusDbField::DbMinorVersion, TARAXA_DB_MINOR_VERSION);
   } else {
-    if (major_version != TARAXA_DB_MAJOR_VERSION) {
+    if (major_version == kPeriodDataMigrationDbMajorVersion) {
+      // Db of the previous major version is upgraded in place by migratePeriodData. Version is updated before the
+      // migration starts, so older nodes can not open db with partially migrated period data
+      saveStatusField(StatusDbField::DbMajorVersion, TARAXA_DB_MAJOR_VERSION);
+      saveStatusField(StatusDbField::DbMinorVersion, TARAXA_DB_MINOR_VERSION);
+      LOG(log_si_) << "Upgrading database from version " << getFormattedVersion({major_version, minor_version})
+                   << " to " << getFormattedVersion({TARAXA_DB_MAJOR_VERSION, TARAXA_DB_MINOR_VERSION});
+    } else if (major_version != TARAXA_DB_MAJOR_VERSION) {
       throw DbException(string("Database version mismatch. Version on disk ") +
                         getFormattedVersion({major_version, minor_version}) +
                         " Node version:" + getFormattedVersion({TARAXA_DB_MAJOR_VERSION, TARAXA_DB_MINOR_VERSION}));
@@ -93,6 +119,225 @@ DbStorage::DbStorage(fs::path const& path, uint32_t db_snapshot_each_n_pbft_bloc
       minor_version_changed_ = true;
     }
   }
+
+  migratePeriodData();
+  group_commit_worker_ = std::thread([this] { groupCommit(); });
+
+  history_pruning_target_ = getStatusField(StatusDbField::HistoryPruningTarget);
+  history_pruned_period_ = getStatusField(StatusDbField::HistoryPrunedPeriod);
+  if (history_pruned_period_ < history_pruning_target_) {
+    LOG(log_si_) << "Resuming deletion of history from period " << history_pruned_period_ << " to "
+                 << history_pruning_target_;
+    startHistoryPruningWorker();
+  }
+
+  // Receipts of blocks that are not migrated yet are read by transaction hashes, so node does not wait for migration
+  if (!getStatusField(StatusDbField::BlockReceiptsMigrated)) {
+    block_receipts_migration_worker_ = std::thread([this] {
+      try {
+        migrateBlockReceipts();
+      } catch (const DbException& e) {
+        LOG(log_er_) << "Block receipts migration failed, it will be resumed after restart: " << e.what();
+      }
+    });
+  }
+}
+
+rocksdb::ColumnFamilyOptions DbStorage::makeColumnOptions(
+    Column const& col, DbColumnsConfig const& config,
+    std::map<std::string, std::shared_ptr<rocksdb::Cache>>& profile_block_caches) {
+  auto profile_name = col.profile_;
+  if (const auto it = config.column_profiles.find(col.name()); it != config.column_profiles.end()) {
+    profile_name = it->second;
+  }
+  const auto profile_it = config.profiles.find(profile_name);
+  if (profile_it == config.profiles.end()) {
+    throw DbException("Column " + col.name() + " uses unknown profile " + profile_name);
+  }
+  const auto& profile = profile_it->second;
+
+  rocksdb::ColumnFamilyOptions options;
+  if (col.comparator_) options.comparator = col.comparator_;
+  if (profile.compression == DbColumnProfileConfig::kZSTDCompression) {
+    options.compression = rocksdb::CompressionType::kZSTD;
+  } else if (profile.compression == DbColumnProfileConfig::kNoCompression) {
+    options.compression = rocksdb::CompressionType::kNoCompression;
+  } else {
+    options.compression = rocksdb::CompressionType::kLZ4Compression;
+  }
+  if (profile.write_buffer_size) {
+    options.write_buffer_size = size_t(profile.write_buffer_size) << 20;
+  }
+  if (profile.prefix_length) {
+    options.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(profile.prefix_length));
+  }
+
+  rocksdb::BlockBasedTableOptions table_options;
+  if (profile.block_size) {
+    table_options.block_size = size_t(profile.block_size) << 10;
+  }
+  if (profile.bloom_bits_per_key) {
+    table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(profile.bloom_bits_per_key, false));
+  }
+  if (const size_t cache_size = (size_t(config.block_cache_size) << 20) * profile.block_cache_share / 100;
+      cache_size) {
+    auto& cache = profile_block_caches[profile_name];
+    if (!cache) {
+      cache = rocksdb::NewLRUCache(cache_size);
+    }
+    table_options.block_cache = cache;
+    // Index and filter blocks are accounted in the cache, so memory usage is bounded by the cache size
+    table_options.cache_index_and_filter_blocks = true;
+    table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+  }
+  options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+
+  return options;
+}
+
+void DbStorage::migratePeriodData() {
+  if (getStatusField(StatusDbField::PeriodDataMigrated)) {
+    return;
+  }
+
+  // Migration can be interrupted at any point, it is resumed from the period stored with the last committed batch.
+  // Periods migrated after that are skipped based on the stored item count
+  const PbftPeriod start_period = getStatusField(StatusDbField::PeriodDataMigratedPeriod);
+  uint64_t migrated_count = 0;
+  auto write_batch = createWriteBatch();
+  auto it = std::unique_ptr<rocksdb::Iterator>(db_->NewIterator(read_options_, handle(Columns::period_data)));
+  PbftPeriod last_period = 0;
+  it->SeekToLast();
+  if (it->Valid()) {
+    memcpy(&last_period, it->key().data(), sizeof(PbftPeriod));
+    LOG(log_si_) << "Starting period data migration from period " << start_period << " to period " << last_period
+                 << ", node is started once it is finished";
+  }
+  for (it->Seek(toSlice(start_period)); it->Valid(); it->Next()) {
+    const dev::RLP period_data_rlp(dev::bytesConstRef(reinterpret_cast<const uint8_t*>(it->value().data()),
+                                                      it->value().size()));
+    if (period_data_rlp.itemCount() != PeriodData::kRlpItemCount) {
+      continue;
+    }
+
+    PbftPeriod period;
+    memcpy(&period, it->key().data(), sizeof(PbftPeriod));
+
+    uint32_t block_pos = 0;
+    for (const auto dag_block : period_data_rlp[DAG_BLOCKS_POS_IN_PERIOD_DATA]) {
+      insert(write_batch, Columns::period_dag_blocks, toPeriodPositionKey(period, block_pos++), dag_block.data());
+    }
+    uint32_t trx_pos = 0;
+    for (const auto trx : period_data_rlp[TRANSACTIONS_POS_IN_PERIOD_DATA]) {
+      insert(write_batch, Columns::period_transactions, toPeriodPositionKey(period, trx_pos++), trx.data());
+    }
+
+    dev::RLPStream s(STORED_PERIOD_DATA_ITEM_COUNT);
+    s.appendRaw(period_data_rlp[PBFT_BLOCK_POS_IN_PERIOD_DATA].data());
+    s.appendRaw(period_data_rlp[CERT_VOTES_POS_IN_PERIOD_DATA].data());
+    insert(write_batch, Columns::period_data, toSlice(period), toSlice(s.out()));
+
+    if (++migrated_count % PERIOD_DATA_MIGRATION_BATCH_SIZE == 0) {
+      addStatusFieldToBatch(StatusDbField::PeriodDataMigratedPeriod, period + 1, write_batch);
+      commitWriteBatch(write_batch);
+      write_batch = createWriteBatch();
+      LOG(log_si_) << "Migrated period data of " << migrated_count << " periods, last migrated period " << period
+                   << " of " << last_period;
+    }
+  }
+  commitWriteBatch(write_batch);
+
+  if (migrated_count) {
+    LOG(log_si_) << "Period data migration finished, migrated " << migrated_count << " periods";
+  }
+  saveStatusField(StatusDbField::PeriodDataMigrated, 1);
+}
+
+void DbStorage::migrateBlockReceipts() {
+  // Migration can be interrupted at any point, already migrated blocks are skipped
+  LOG(log_si_) << "Starting block receipts migration";
+  uint64_t migrated_count = 0;
+  auto write_batch = createWriteBatch();
+  auto it = std::unique_ptr<rocksdb::Iterator>(
+      db_->NewIterator(read_options_, handle(Columns::final_chain_transaction_hashes_by_blk_number)));
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    if (stop_block_receipts_migration_) {
+      commitWriteBatch(write_batch);
+      LOG(log_si_) << "Block receipts migration stopped, it will be resumed after restart";
+      return;
+    }
+    EthBlockNumber blk_n;
+    memcpy(&blk_n, it->key().data(), sizeof(EthBlockNumber));
+    if (exist(blk_n, Columns::final_chain_receipts_by_blk_number)) {
+      continue;
+    }
+    // History scheduled for deletion is not migrated
+    {
+      std::unique_lock lock(history_pruning_mutex_);
+      if (blk_n < history_pruning_target_) {
+        continue;
+      }
+    }
+
+    const auto hashes_count = it->value().size() / trx_hash_t::size;
+    std::vector<trx_hash_t> hashes;
+    hashes.reserve(hashes_count);
+    for (size_t i = 0; i < hashes_count; i++) {
+      hashes.emplace_back((uint8_t*)(it->value().data() + i * trx_hash_t::size), trx_hash_t::ConstructFromPointer);
+    }
+    const auto receipts = multiLookup(hashes, Columns::final_chain_receipt_by_trx_hash);
+    // Receipts of pruned history are not available anymore
+    if (std::any_of(receipts.begin(), receipts.end(), [](const auto& r) { return r.empty(); })) {
+      continue;
+    }
+    dev::RLPStream s(receipts.size());
+    for (const auto& receipt : receipts) {
+      s.appendRaw(dev::bytesConstRef(reinterpret_cast<const uint8_t*>(receipt.data()), receipt.size()));
+    }
+    insert(write_batch, Columns::final_chain_receipts_by_blk_number, blk_n, s.out());
+
+    if (++migrated_count % PERIOD_DATA_MIGRATION_BATCH_SIZE == 0) {
+      commitWriteBatch(write_batch);
+      write_batch = createWriteBatch();
+      LOG(log_si_) << "Migrated receipts of " << migrated_count << " blocks";
+    }
+  }
+  checkStatus(it->status());
+  commitWriteBatch(write_batch);
+
+  if (migrated_count) {
+    LOG(log_si_) << "Block receipts migration finished, migrated " << migrated_count << " blocks";
+  }
+  saveStatusField(StatusDbField::BlockReceiptsMigrated, 1);
+}
+
+dev::bytes DbStorage::toPeriodPositionKey(PbftPeriod period, uint32_t position) {
+  dev::bytes key(sizeof(PbftPeriod) + sizeof(uint32_t));
+  for (size_t i = 0; i < sizeof(PbftPeriod); i++) {
+    key[i] = static_cast<uint8_t>(period >> (8 * (sizeof(PbftPeriod) - 1 - i)));
+  }
+  for (size_t i = 0; i < sizeof(uint32_t); i++) {
+    key[sizeof(PbftPeriod) + i] = static_cast<uint8_t>(position >> (8 * (sizeof(uint32_t) - 1 - i)));
+  }
+  return key;
+}
+
+std::vector<std::string> DbStorage::getPeriodEntries(PbftPeriod period, Column const& column) const {
+  std::vector<std::string> entries;
+  const auto start_key = toPeriodPositionKey(period, 0);
+  const auto end_key = toPeriodPositionKey(period + 1, 0);
+  const auto end_slice = toSlice(end_key);
+  auto read_options = read_options_;
+  read_options.iterate_upper_bound = &end_slice;
+  // Enables prefix bloom filter if column has prefix extractor that is compatible with the range
+  read_options.auto_prefix_mode = true;
+
+  auto it = std::unique_ptr<rocksdb::Iterator>(db_->NewIterator(read_options, handle(column)));
+  for (it->Seek(toSlice(start_key)); it->Valid(); it->Next()) {
+    entries.emplace_back(it->value().ToString());
+  }
+  checkStatus(it->status());
+  return entries;
 }
 
 void DbStorage::rebuildColumns(const rocksdb::Options& options) {
@@ -251,6 +496,17 @@ std::optional<h256> DbStorage::getGenesisHash() {
 }
 
 DbStorage::~DbStorage() {
+  stop_block_receipts_migration_ = true;
+  if (block_receipts_migration_worker_.joinable()) {
+    block_receipts_migration_worker_.join();
+  }
+  stopHistoryPruning();
+  {
+    std::unique_lock lock(group_commit_mutex_);
+    stop_group_commit_ = true;
+  }
+  group_commit_cv_.notify_all();
+  group_commit_worker_.join();
   for (auto cf : handles_) {
     checkStatus(db_->DestroyColumnFamilyHandle(cf));
   }
@@ -266,10 +522,92 @@ void DbStorage::checkStatus(rocksdb::Status const& status) {
 DbStorage::Batch DbStorage::createWriteBatch() { return DbStorage::Batch(); }
 
 void DbStorage::commitWriteBatch(Batch& write_batch, rocksdb::WriteOptions const& opts) {
+  if (opts.sync) {
+    std::promise<rocksdb::Status> committed;
+    auto committed_future = committed.get_future();
+    commitWriteBatchAsync(std::move(write_batch),
+                          [&committed](rocksdb::Status const& status) { committed.set_value(status); });
+    checkStatus(committed_future.get());
+    return;
+  }
   auto status = db_->Write(opts, write_batch.GetWriteBatch());
   checkStatus(status);
 }
 
+void DbStorage::commitWriteBatchAsync(Batch&& write_batch, std::function<void(rocksdb::Status const&)> on_committed) {
+  {
+    std::unique_lock lock(group_commit_mutex_);
+    if (!stop_group_commit_) {
+      group_commit_queue_.push_back({std::move(write_batch), std::move(on_committed)});
+      on_committed = nullptr;
+    }
+  }
+  if (on_committed) {
+    on_committed(rocksdb::Status::Aborted("Db is being closed"));
+    return;
+  }
+  group_commit_cv_.notify_one();
+}
+
+void DbStorage::groupCommit() {
+  std::deque<PendingCommit> group;
+  std::vector<rocksdb::Status> statuses;
+  auto write_options = write_options_;
+  write_options.sync = false;
+  while (true) {
+    {
+      std::unique_lock lock(group_commit_mutex_);
+      group_commit_cv_.wait(lock, [this] { return stop_group_commit_ || !group_commit_queue_.empty(); });
+      // Pending batches are committed even when stopping
+      if (group_commit_queue_.empty()) {
+        return;
+      }
+      // Latency of the first batch is bounded by the window
+      if (const std::chrono::microseconds window(group_commit_window_us_); window.count() && !stop_group_commit_) {
+        group_commit_cv_.wait_for(lock, window, [this] {
+          return stop_group_commit_ || group_commit_queue_.size() >= GROUP_COMMIT_MAX_BATCHES;
+        });
+      }
+      group.swap(group_commit_queue_);
+    }
+
+    statuses.clear();
+    bool written = false;
+    for (auto& commit : group) {
+      statuses.push_back(db_->Write(write_options, commit.batch.GetWriteBatch()));
+      written |= statuses.back().ok();
+    }
+    // Single WAL sync makes all the batches written before it durable
+    rocksdb::Status sync_status;
+    if (written) {
+      const auto sync_start = std::chrono::steady_clock::now();
+      sync_status = db_->SyncWAL();
+      const uint64_t sync_latency_us =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sync_start).count();
+      group_commit_syncs_++;
+      group_commit_batches_ += group.size();
+      group_commit_last_batches_ = group.size();
+      group_commit_sync_latency_us_ += sync_latency_us;
+      group_commit_last_sync_latency_us_ = sync_latency_us;
+    }
+
+    for (size_t i = 0; i < group.size(); i++) {
+      group[i].on_committed(statuses[i].ok() ? sync_status : statuses[i]);
+    }
+    group.clear();
+  }
+}
+
+DbStorage::GroupCommitStats DbStorage::getGroupCommitStats() const {
+  GroupCommitStats stats;
+  stats.syncs = group_commit_syncs_;
+  stats.batches = group_commit_batches_;
+  stats.last_batches = group_commit_last_batches_;
+  stats.sync_latency_us = group_commit_sync_latency_us_;
+  stats.last_sync_latency_us = group_commit_last_sync_latency_us_;
+  return stats;
+}
+
 std::shared_ptr<DagBlock> DbStorage::getDagBlock(blk_hash_t const& hash) {
   auto block_data = asBytes(lookup(toSlice(hash.asBytes()), Columns::dag_blocks));
   if (block_data.size() > 0) {
@@ -277,11 +615,9 @@ std::shared_ptr<DagBlock> DbStorage::getDagBlock(blk_hash_t const& hash) {
   }
   auto data = getDagBlockPeriod(hash);
   if (data) {
-    auto period_data = getPeriodDataRaw(data->first);
-    if (period_data.size() > 0) {
-      auto period_data_rlp = dev::RLP(period_data);
-      auto dag_blocks_data = period_data_rlp[DAG_BLOCKS_POS_IN_PERIOD_DATA];
-      return std::make_shared<DagBlock>(dag_blocks_data[data->second]);
+    block_data = asBytes(lookup(toPeriodPositionKey(data->first, data->second), Columns::period_dag_blocks));
+    if (block_data.size() > 0) {
+      return std::make_shared<DagBlock>(block_data);
     }
   }
   return nullptr;
@@ -432,45 +768,192 @@ std::optional<SortitionParamsChange> DbStorage::getParamsChangeForPeriod(PbftPer
 }
 
 void DbStorage::clearPeriodDataHistory(PbftPeriod end_period) {
-  // This is expensive operation but it should not be run more than once a day
-  auto it = std::unique_ptr<rocksdb::Iterator>(db_->NewIterator(read_options_, handle(Columns::period_data)));
-  // Find the first non-deleted period
-  it->SeekToFirst();
-  if (it->Valid()) {
-    uint64_t start_period;
-    memcpy(&start_period, it->key().data(), sizeof(uint64_t));
-    if (start_period < end_period) {
-      auto write_batch = createWriteBatch();
-      // Delete up to max 10000 period at once
-      const uint32_t max_batch_delete = 10000;
-      auto start_slice = toSlice(start_period);
-      auto end_slice = toSlice(end_period);
-      for (auto period = start_period; period < end_period; period++) {
-        // Find transactions included in the old blocks and delete data related to these transactions to free disk space
-        auto trx_hashes_raw = lookup(period, DB::Columns::final_chain_transaction_hashes_by_blk_number);
-        auto hashes_count = trx_hashes_raw.size() / trx_hash_t::size;
-        for (uint32_t i = 0; i < hashes_count; i++) {
-          auto hash =
-              trx_hash_t((uint8_t*)(trx_hashes_raw.data() + i * trx_hash_t::size), trx_hash_t::ConstructFromPointer);
-          remove(write_batch, Columns::final_chain_receipt_by_trx_hash, hash);
-          remove(write_batch, Columns::final_chain_transaction_location_by_hash, hash);
-        }
-        remove(write_batch, Columns::final_chain_transaction_hashes_by_blk_number, EthBlockNumber(period));
-        if ((period - start_period + 1) % max_batch_delete == 0) {
-          commitWriteBatch(write_batch);
-          write_batch = createWriteBatch();
+  {
+    std::unique_lock lock(history_pruning_mutex_);
+    if (end_period <= history_pruning_target_) {
+      return;
+    }
+    history_pruning_target_ = end_period;
+    saveStatusField(StatusDbField::HistoryPruningTarget, end_period);
+  }
+  startHistoryPruningWorker();
+  history_pruning_cv_.notify_one();
+}
+
+void DbStorage::startHistoryPruning(uint64_t rate_limit) {
+  {
+    std::unique_lock lock(history_pruning_mutex_);
+    if (history_pruning_rate_limiter_) {
+      history_pruning_rate_limiter_->SetBytesPerSecond(rate_limit);
+    } else {
+      history_pruning_rate_limiter_.reset(rocksdb::NewGenericRateLimiter(rate_limit));
+    }
+  }
+  startHistoryPruningWorker();
+}
+
+void DbStorage::startHistoryPruningWorker() {
+  std::unique_lock lock(history_pruning_mutex_);
+  if (history_pruning_worker_.joinable()) {
+    return;
+  }
+  // Rate limiter is created only on nodes which actually delete the history
+  if (!history_pruning_rate_limiter_) {
+    history_pruning_rate_limiter_.reset(rocksdb::NewGenericRateLimiter(kDefaultHistoryPruningRateLimit));
+  }
+  stop_history_pruning_ = false;
+  history_compaction_canceled_ = false;
+  history_pruning_worker_ = std::thread([this] { pruneHistory(); });
+}
+
+void DbStorage::stopHistoryPruning() {
+  {
+    std::unique_lock lock(history_pruning_mutex_);
+    stop_history_pruning_ = true;
+  }
+  // Compaction of the whole column can take long time, so it is canceled instead of waited for
+  history_compaction_canceled_ = true;
+  history_pruning_cv_.notify_all();
+  if (history_pruning_worker_.joinable()) {
+    history_pruning_worker_.join();
+  }
+}
+
+void DbStorage::pruneHistory() {
+  try {
+    while (true) {
+      {
+        std::unique_lock lock(history_pruning_mutex_);
+        history_pruning_cv_.wait(
+            lock, [this] { return stop_history_pruning_ || history_pruned_period_ < history_pruning_target_; });
+        if (stop_history_pruning_) {
+          return;
         }
       }
-      commitWriteBatch(write_batch);
+      while (pruneHistoryChunk()) {
+      }
+      compactPrunedHistory();
+    }
+  } catch (const DbException& e) {
+    LOG(log_er_) << "Deletion of history failed, it will be resumed after restart: " << e.what();
+  }
+}
 
-      db_->DeleteRange(write_options_, handle(Columns::period_data), start_slice, end_slice);
-      // Deletion alone does not guarantee that the disk space is freed, these CompactRange methods actually compact the
-      // data in the database and free disk space
-      db_->CompactRange({}, handle(Columns::period_data), &start_slice, &end_slice);
-      db_->CompactRange({}, handle(Columns::final_chain_receipt_by_trx_hash), nullptr, nullptr);
-      db_->CompactRange({}, handle(Columns::final_chain_transaction_location_by_hash), nullptr, nullptr);
-      db_->CompactRange({}, handle(Columns::final_chain_transaction_hashes_by_blk_number), nullptr, nullptr);
+bool DbStorage::pruneHistoryChunk() {
+  PbftPeriod start_period, target_period;
+  {
+    std::unique_lock lock(history_pruning_mutex_);
+    if (stop_history_pruning_ || history_pruned_period_ >= history_pruning_target_) {
+      return false;
+    }
+    start_period = history_pruned_period_;
+    target_period = history_pruning_target_;
+  }
+
+  if (!start_period) {
+    // Find the first non-deleted period
+    auto it = std::unique_ptr<rocksdb::Iterator>(db_->NewIterator(read_options_, handle(Columns::period_data)));
+    it->SeekToFirst();
+    checkStatus(it->status());
+    start_period = target_period;
+    if (it->Valid()) {
+      memcpy(&start_period, it->key().data(), sizeof(PbftPeriod));
     }
+    start_period = std::min(start_period, target_period);
+  }
+  const auto end_period = std::min(start_period + HISTORY_PRUNING_CHUNK_SIZE, target_period);
+
+  auto write_batch = createWriteBatch();
+  size_t read_bytes = 0;
+  for (auto period = start_period; period < end_period; period++) {
+    // Find transactions included in the old blocks and delete data related to these transactions to free disk space
+    auto trx_hashes_raw = lookup(period, DB::Columns::final_chain_transaction_hashes_by_blk_number);
+    read_bytes += trx_hashes_raw.size();
+    auto hashes_count = trx_hashes_raw.size() / trx_hash_t::size;
+    for (uint32_t i = 0; i < hashes_count; i++) {
+      auto hash =
+          trx_hash_t((uint8_t*)(trx_hashes_raw.data() + i * trx_hash_t::size), trx_hash_t::ConstructFromPointer);
+      remove(write_batch, Columns::final_chain_receipt_by_trx_hash, hash);
+      remove(write_batch, Columns::final_chain_transaction_location_by_hash, hash);
+    }
+    remove(write_batch, Columns::final_chain_transaction_hashes_by_blk_number, EthBlockNumber(period));
+    history_deleted_keys_ += 2 * hashes_count + 1;
+  }
+
+  // Keys of these columns are ordered by period, so whole chunk is deleted by range tombstones
+  checkStatus(write_batch.DeleteRange(handle(Columns::period_data), toSlice(start_period), toSlice(end_period)));
+  checkStatus(write_batch.DeleteRange(handle(Columns::final_chain_receipts_by_blk_number),
+                                      toSlice(EthBlockNumber(start_period)), toSlice(EthBlockNumber(end_period))));
+  const auto start_position_key = toPeriodPositionKey(start_period, 0);
+  const auto end_position_key = toPeriodPositionKey(end_period, 0);
+  checkStatus(write_batch.DeleteRange(handle(Columns::period_dag_blocks), toSlice(start_position_key),
+                                      toSlice(end_position_key)));
+  checkStatus(write_batch.DeleteRange(handle(Columns::period_transactions), toSlice(start_position_key),
+                                      toSlice(end_position_key)));
+  // Progress is stored together with the deletion, so it is resumed from the right period after restart
+  addStatusFieldToBatch(StatusDbField::HistoryPrunedPeriod, end_period, write_batch);
+
+  for (auto bytes = read_bytes + write_batch.GetDataSize(); bytes > 0;) {
+    const auto request = std::min<size_t>(bytes, history_pruning_rate_limiter_->GetSingleBurstBytes());
+    history_pruning_rate_limiter_->Request(request, rocksdb::Env::IO_LOW, nullptr);
+    bytes -= request;
+  }
+  auto write_options = write_options_;
+  write_options.low_pri = true;
+  commitWriteBatch(write_batch, write_options);
+
+  std::unique_lock lock(history_pruning_mutex_);
+  history_pruned_period_ = end_period;
+  return true;
+}
+
+void DbStorage::compactPrunedHistory() {
+  PbftPeriod pruned_period;
+  {
+    std::unique_lock lock(history_pruning_mutex_);
+    // Compaction is deferred until all scheduled history is deleted
+    if (stop_history_pruning_ || history_pruned_period_ < history_pruning_target_) {
+      return;
+    }
+    pruned_period = history_pruned_period_;
+  }
+
+  rocksdb::CompactRangeOptions options;
+  // Do not block automatic compactions while compacting the pruned history
+  options.exclusive_manual_compaction = false;
+  options.canceled = &history_compaction_canceled_;
+  // Returns false if compaction was canceled by stopHistoryPruning, range is then compacted after the next pruning
+  const auto compact = [&](const Column& column, const rocksdb::Slice* end) {
+    const auto status = db_->CompactRange(options, handle(column), nullptr, end);
+    if (history_compaction_canceled_) {
+      return false;
+    }
+    checkStatus(status);
+    return true;
+  };
+
+  if (history_compacted_period_ < pruned_period) {
+    // Deletion alone does not guarantee that the disk space is freed, compaction of the deleted range actually frees it
+    const auto end_slice = toSlice(pruned_period);
+    const auto end_position_key = toPeriodPositionKey(pruned_period, 0);
+    const auto end_position_slice = toSlice(end_position_key);
+    if (!compact(Columns::period_data, &end_slice) ||
+        !compact(Columns::final_chain_receipts_by_blk_number, &end_slice) ||
+        !compact(Columns::period_dag_blocks, &end_position_slice) ||
+        !compact(Columns::period_transactions, &end_position_slice)) {
+      return;
+    }
+    history_compacted_period_ = pruned_period;
+  }
+
+  // Deleted keys are spread over the whole key space of hash keyed columns, so only full compaction frees the space
+  if (history_deleted_keys_ >= HISTORY_PRUNING_COMPACTION_THRESHOLD) {
+    if (!compact(Columns::final_chain_receipt_by_trx_hash, nullptr) ||
+        !compact(Columns::final_chain_transaction_location_by_hash, nullptr) ||
+        !compact(Columns::final_chain_transaction_hashes_by_blk_number, nullptr)) {
+      return;
+    }
+    history_deleted_keys_ = 0;
   }
 }
 
@@ -483,6 +966,7 @@ void DbStorage::savePeriodData(const PeriodData& period_data, Batch& write_batch
   for (auto const& block : period_data.dag_blocks) {
     removeDagBlockBatch(write_batch, block.getHash());
     addDagBlockPeriodToBatch(block.getHash(), period, block_pos, write_batch);
+    insert(write_batch, Columns::period_dag_blocks, toPeriodPositionKey(period, block_pos), block.rlp(true));
     block_pos++;
   }
 
@@ -491,14 +975,41 @@ void DbStorage::savePeriodData(const PeriodData& period_data, Batch& write_batch
   for (auto const& trx : period_data.transactions) {
     removeTransactionToBatch(trx->getHash(), write_batch);
     addTransactionPeriodToBatch(write_batch, trx->getHash(), period_data.pbft_blk->getPeriod(), trx_pos);
+    insert(write_batch, Columns::period_transactions, toPeriodPositionKey(period, trx_pos), trx->rlp());
     trx_pos++;
   }
 
-  insert(write_batch, Columns::period_data, toSlice(period), toSlice(period_data.rlp()));
+  dev::RLPStream s(STORED_PERIOD_DATA_ITEM_COUNT);
+  s.appendRaw(period_data.pbft_blk->rlp(true));
+  s.appendList(period_data.previous_block_cert_votes.size());
+  for (auto const& v : period_data.previous_block_cert_votes) {
+    s.appendRaw(v->rlp(true));
+  }
+  insert(write_batch, Columns::period_data, toSlice(period), toSlice(s.out()));
 }
 
 dev::bytes DbStorage::getPeriodDataRaw(PbftPeriod period) const {
-  return asBytes(lookup(toSlice(period), Columns::period_data));
+  const auto stored_data = asBytes(lookup(toSlice(period), Columns::period_data));
+  if (stored_data.empty()) {
+    return {};
+  }
+
+  // Reassemble period data from pbft block, cert votes, dag blocks and transactions stored separately
+  const dev::RLP stored_data_rlp(stored_data);
+  const auto dag_blocks = getPeriodEntries(period, Columns::period_dag_blocks);
+  const auto transactions = getPeriodEntries(period, Columns::period_transactions);
+  dev::RLPStream s(PeriodData::kRlpItemCount);
+  s.appendRaw(stored_data_rlp[PBFT_BLOCK_POS_IN_PERIOD_DATA].data());
+  s.appendRaw(stored_data_rlp[CERT_VOTES_POS_IN_PERIOD_DATA].data());
+  s.appendList(dag_blocks.size());
+  for (const auto& dag_block : dag_blocks) {
+    s.appendRaw(bytesConstRef(reinterpret_cast<const uint8_t*>(dag_block.data()), dag_block.size()));
+  }
+  s.appendList(transactions.size());
+  for (const auto& trx : transactions) {
+    s.appendRaw(bytesConstRef(reinterpret_cast<const uint8_t*>(trx.data()), trx.size()));
+  }
+  return s.invalidate();
 }
 
 void DbStorage::saveTransaction(Transaction const& trx) {
@@ -522,8 +1033,7 @@ void DbStorage::addTransactionPeriodToBatch(Batch& write_batch, trx_hash_t const
   insert(write_batch, Columns::trx_period, toSlice(trx.asBytes()), toSlice(s.out()));
 }
 
-std::optional<std::pair<PbftPeriod, uint32_t>> DbStorage::getTransactionPeriod(trx_hash_t const& hash) const {
-  auto data = lookup(toSlice(hash.asBytes()), Columns::trx_period);
+static std::optional<std::pair<PbftPeriod, uint32_t>> decodeTransactionPeriod(const std::string& data) {
   if (!data.empty()) {
     std::pair<PbftPeriod, uint32_t> res;
     dev::RLP const rlp(data);
@@ -535,14 +1045,21 @@ std::optional<std::pair<PbftPeriod, uint32_t>> DbStorage::getTransactionPeriod(t
   return std::nullopt;
 }
 
+std::optional<std::pair<PbftPeriod, uint32_t>> DbStorage::getTransactionPeriod(trx_hash_t const& hash) const {
+  return decodeTransactionPeriod(lookup(toSlice(hash.asBytes()), Columns::trx_period));
+}
+
+std::vector<std::optional<std::pair<PbftPeriod, uint32_t>>> DbStorage::getTransactionsPeriod(
+    std::vector<trx_hash_t> const& hashes) const {
+  const auto data = multiLookup(hashes, Columns::trx_period);
+  std::vector<std::optional<std::pair<PbftPeriod, uint32_t>>> ret;
+  ret.reserve(data.size());
+  std::transform(data.begin(), data.end(), std::back_inserter(ret), decodeTransactionPeriod);
+  return ret;
+}
+
 std::vector<bool> DbStorage::transactionsFinalized(std::vector<trx_hash_t> const& trx_hashes) {
-  std::vector<bool> result(trx_hashes.size(), false);
-  for (size_t i = 0; i < trx_hashes.size(); ++i) {
-    if (exist(toSlice(trx_hashes[i].asBytes()), Columns::trx_period)) {
-      result[i] = true;
-    }
-  }
-  return result;
+  return multiExist(trx_hashes, Columns::trx_period);
 }
 
 std::unordered_map<trx_hash_t, PbftPeriod> DbStorage::getAllTransactionPeriod() {
@@ -576,7 +1093,7 @@ std::vector<std::shared_ptr<PbftBlock>> DbStorage::getProposedPbftBlocks() {
 }
 
 std::optional<PbftBlock> DbStorage::getPbftBlock(PbftPeriod period) const {
-  auto period_data = getPeriodDataRaw(period);
+  auto period_data = asBytes(lookup(toSlice(period), Columns::period_data));
   // DB is corrupted if status point to missing or incorrect transaction
   if (period_data.size() > 0) {
     auto period_data_rlp = dev::RLP(period_data);
@@ -600,11 +1117,9 @@ std::shared_ptr<Transaction> DbStorage::getTransaction(trx_hash_t const& hash) {
   }
   auto res = getTransactionPeriod(hash);
   if (res) {
-    auto period_data = getPeriodDataRaw(res->first);
-    if (period_data.size() > 0) {
-      auto period_data_rlp = dev::RLP(period_data);
-      auto transaction_data = period_data_rlp[TRANSACTIONS_POS_IN_PERIOD_DATA];
-      return std::make_shared<Transaction>(transaction_data[res->second]);
+    data = asBytes(lookup(toPeriodPositionKey(res->first, res->second), Columns::period_transactions));
+    if (data.size() > 0) {
+      return std::make_shared<Transaction>(data);
     }
   }
   return nullptr;
@@ -614,42 +1129,43 @@ std::pair<std::optional<SharedTransactions>, trx_hash_t> DbStorage::getFinalized
     std::vector<trx_hash_t> const& trx_hashes) const {
   // Map of period to position of transactions within a period
   std::map<PbftPeriod, std::set<uint32_t>> period_map;
-  SharedTransactions transactions;
-  transactions.reserve(trx_hashes.size());
-  for (auto const& tx_hash : trx_hashes) {
-    auto trx_period = getTransactionPeriod(tx_hash);
-    if (trx_period.has_value()) {
-      period_map[trx_period->first].insert(trx_period->second);
+  const auto trx_periods = getTransactionsPeriod(trx_hashes);
+  for (size_t i = 0; i < trx_hashes.size(); ++i) {
+    if (trx_periods[i].has_value()) {
+      period_map[trx_periods[i]->first].insert(trx_periods[i]->second);
     } else {
-      return {std::nullopt, tx_hash};
+      return {std::nullopt, trx_hashes[i]};
     }
   }
-  for (auto it : period_map) {
-    const auto period_data = getPeriodDataRaw(it.first);
-    if (!period_data.size()) {
-      assert(false);
-    }
 
-    auto const transactions_rlp = dev::RLP(period_data)[TRANSACTIONS_POS_IN_PERIOD_DATA];
+  std::vector<dev::bytes> keys;
+  keys.reserve(trx_hashes.size());
+  for (auto const& it : period_map) {
     for (auto pos : it.second) {
-      transactions.emplace_back(std::make_shared<Transaction>(transactions_rlp[pos]));
+      keys.emplace_back(toPeriodPositionKey(it.first, pos));
     }
   }
 
+  SharedTransactions transactions;
+  transactions.reserve(keys.size());
+  for (const auto& trx_data : multiLookup(keys, Columns::period_transactions)) {
+    assert(trx_data.size());
+    transactions.emplace_back(std::make_shared<Transaction>(asBytes(trx_data)));
+  }
+
   return {transactions, {}};
 }
 
 std::optional<SharedTransactions> DbStorage::getPeriodTransactions(PbftPeriod period) const {
-  const auto period_data = getPeriodDataRaw(period);
-  if (!period_data.size()) {
+  if (lookup(toSlice(period), Columns::period_data).empty()) {
     return std::nullopt;
   }
 
-  auto period_data_rlp = dev::RLP(period_data);
-
-  SharedTransactions ret(period_data_rlp[TRANSACTIONS_POS_IN_PERIOD_DATA].size());
-  for (const auto transaction_data : period_data_rlp[TRANSACTIONS_POS_IN_PERIOD_DATA]) {
-    ret.emplace_back(std::make_shared<Transaction>(transaction_data));
+  const auto transactions = getPeriodEntries(period, Columns::period_transactions);
+  SharedTransactions ret;
+  ret.reserve(transactions.size());
+  for (const auto& transaction_data : transactions) {
+    ret.emplace_back(std::make_shared<Transaction>(asBytes(transaction_data)));
   }
   return {ret};
 }
@@ -671,13 +1187,21 @@ bool DbStorage::transactionFinalized(trx_hash_t const& hash) {
 }
 
 std::vector<bool> DbStorage::transactionsInDb(std::vector<trx_hash_t> const& trx_hashes) {
-  std::vector<bool> result(trx_hashes.size(), false);
+  auto result = multiExist(trx_hashes, Columns::transactions);
+
+  // Only transactions which are not in transactions column are looked up in trx_period column
+  std::vector<size_t> missing_positions;
+  std::vector<trx_hash_t> missing_hashes;
   for (size_t i = 0; i < trx_hashes.size(); ++i) {
-    const auto key = trx_hashes[i].asBytes();
-    if (exist(toSlice(key), Columns::transactions) || exist(toSlice(key), Columns::trx_period)) {
-      result[i] = true;
+    if (!result[i]) {
+      missing_positions.push_back(i);
+      missing_hashes.push_back(trx_hashes[i]);
     }
   }
+  const auto finalized = multiExist(missing_hashes, Columns::trx_period);
+  for (size_t i = 0; i < missing_positions.size(); ++i) {
+    result[missing_positions[i]] = finalized[i];
+  }
   return result;
 }
 
@@ -840,7 +1364,7 @@ void DbStorage::removeVerifiedVoteToBatch(vote_hash_t const& vote_hash, Batch& w
 
 std::vector<std::shared_ptr<Vote>> DbStorage::getCertVotes(PbftPeriod period) {
   std::vector<std::shared_ptr<Vote>> cert_votes;
-  auto period_data = getPeriodDataRaw(period);
+  auto period_data = asBytes(lookup(toSlice(period), Columns::period_data));
   if (period_data.size() > 0) {
     auto period_data_rlp = dev::RLP(period_data);
     auto cert_votes_data = period_data_rlp[CERT_VOTES_POS_IN_PERIOD_DATA];
@@ -947,24 +1471,20 @@ void DbStorage::addDagBlockPeriodToBatch(blk_hash_t const& hash, PbftPeriod peri
 
 std::vector<blk_hash_t> DbStorage::getFinalizedDagBlockHashesByPeriod(PbftPeriod period) {
   std::vector<blk_hash_t> ret;
-  if (auto period_data = getPeriodDataRaw(period); period_data.size() > 0) {
-    auto dag_blocks_data = dev::RLP(period_data)[DAG_BLOCKS_POS_IN_PERIOD_DATA];
-    ret.reserve(dag_blocks_data.size());
-    std::transform(dag_blocks_data.begin(), dag_blocks_data.end(), std::back_inserter(ret),
-                   [](const auto& dag_block) { return DagBlock(dag_block).getHash(); });
-  }
+  const auto dag_blocks_data = getPeriodEntries(period, Columns::period_dag_blocks);
+  ret.reserve(dag_blocks_data.size());
+  std::transform(dag_blocks_data.begin(), dag_blocks_data.end(), std::back_inserter(ret),
+                 [](const auto& dag_block) { return DagBlock(asBytes(dag_block)).getHash(); });
 
   return ret;
 }
 
 std::vector<std::shared_ptr<DagBlock>> DbStorage::getFinalizedDagBlockByPeriod(PbftPeriod period) {
   std::vector<std::shared_ptr<DagBlock>> ret;
-  if (auto period_data = getPeriodDataRaw(period); period_data.size() > 0) {
-    auto dag_blocks_data = dev::RLP(period_data)[DAG_BLOCKS_POS_IN_PERIOD_DATA];
-    ret.reserve(dag_blocks_data.size());
-    for (auto const block : dag_blocks_data) {
-      ret.emplace_back(std::make_shared<DagBlock>(block));
-    }
+  const auto dag_blocks_data = getPeriodEntries(period, Columns::period_dag_blocks);
+  ret.reserve(dag_blocks_data.size());
+  for (auto const& block : dag_blocks_data) {
+    ret.emplace_back(std::make_shared<DagBlock>(asBytes(block)));
   }
   return ret;
 }
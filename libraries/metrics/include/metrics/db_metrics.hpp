@@ -0,0 +1,21 @@
+#pragma once
+
+#include "metrics/metrics_group.hpp"
+
+namespace taraxa::metrics {
+class DbMetrics : public MetricsGroup {
+ public:
+  inline static const std::string group_name = "db";
+  DbMetrics(std::shared_ptr<prometheus::Registry> registry) : MetricsGroup(std::move(registry)) {}
+
+  ADD_GAUGE_METRIC_WITH_UPDATER(setGroupCommitSyncs, "group_commit_syncs", "Number of WAL syncs done by group commit")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setGroupCommitBatches, "group_commit_batches",
+                                "Number of sync batches committed by group commit")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setGroupCommitLastBatches, "group_commit_last_batches",
+                                "Number of sync batches committed by the last WAL sync")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setWalSyncLatencyTotal, "wal_sync_latency_total_us",
+                                "Total latency of WAL syncs done by group commit in microseconds")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setWalLastSyncLatency, "wal_last_sync_latency_us",
+                                "Latency of the last WAL sync in microseconds")
+};
+}  // namespace taraxa::metrics
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "metrics/metrics_group.hpp"
+
+namespace taraxa::metrics {
+class FinalChainMetrics : public MetricsGroup {
+ public:
+  inline static const std::string group_name = "final_chain";
+  FinalChainMetrics(std::shared_ptr<prometheus::Registry> registry) : MetricsGroup(std::move(registry)) {}
+
+  ADD_GAUGE_METRIC_WITH_UPDATER(setCacheHits, "cache_hits", "Number of lookups served by final chain caches")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setCacheMisses, "cache_misses", "Number of lookups missed by final chain caches")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setCacheSize, "cache_size", "Approximate memory used by final chain caches in bytes")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setCacheEntries, "cache_entries", "Number of entries in final chain caches")
+};
+}  // namespace taraxa::metrics
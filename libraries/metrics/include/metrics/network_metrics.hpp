@@ -10,5 +10,7 @@ class NetworkMetrics : public MetricsGroup {
   ADD_GAUGE_METRIC_WITH_UPDATER(setPeersCount, "peers_count", "Count of peers that node is connected to")
   ADD_GAUGE_METRIC_WITH_UPDATER(setDiscoveredPeersCount, "discovered_peers_count", "Count of discovered peers")
   ADD_GAUGE_METRIC_WITH_UPDATER(setSyncingDuration, "syncing_duration_sec", "Time node is currently in sync state")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setRecoveredTransactionsPerSecond, "recovered_transactions_per_sec",
+                                "Transactions senders recovered per second from incoming transaction packets")
 };
 }  // namespace taraxa::metrics
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "metrics/metrics_group.hpp"
+
+namespace taraxa::metrics {
+class RpcMetrics : public MetricsGroup {
+ public:
+  inline static const std::string group_name = "rpc";
+  RpcMetrics(std::shared_ptr<prometheus::Registry> registry) : MetricsGroup(std::move(registry)) {}
+
+  ADD_GAUGE_METRIC_WITH_UPDATER(setLogsQueries, "logs_queries", "Number of evaluated eth_getLogs queries")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setLogsRejectedQueries, "logs_rejected_queries",
+                                "Number of eth_getLogs queries rejected because of the block range or results limits")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setLogsQueriesLatencyTotal, "logs_queries_latency_total_us",
+                                "Total latency of eth_getLogs queries in microseconds")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setLogsLastQueryLatency, "logs_last_query_latency_us",
+                                "Latency of the last eth_getLogs query in microseconds")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setWsQueuedMessages, "ws_queued_messages",
+                                "Number of messages waiting in send queues of websocket sessions")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setWsQueuedBytes, "ws_queued_bytes",
+                                "Size of messages waiting in send queues of websocket sessions in bytes")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setWsDroppedMessages, "ws_dropped_messages",
+                                "Number of websocket notifications dropped because of full send queues")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setWsDisconnectedSlowConsumers, "ws_disconnected_slow_consumers",
+                                "Number of websocket sessions disconnected because of full send queues")
+};
+}  // namespace taraxa::metrics
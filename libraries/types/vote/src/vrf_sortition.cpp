@@ -2,6 +2,11 @@
 #include "vote/vrf_sortition.hpp"
 
 #include <boost/math/distributions/binomial.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "common/encoding_rlp.hpp"
 
@@ -64,6 +69,58 @@ bytes VrfPbftSortition::getRlpBytes() const {
   return s.invalidate();
 }
 
+namespace {
+
+/**
+ * @brief Lazily filled table of binomial distribution cdf values for fixed number of trials and success probability.
+ *        Binary search in getBinominalDistribution evaluates the same points for all votes that end up with the same
+ *        weight, so only few values per table are ever computed
+ */
+class BinomialCdfTable {
+ public:
+  BinomialCdfTable(uint64_t trials, double probability) : dist_(static_cast<double>(trials), probability) {}
+
+  double cdf(uint64_t k) {
+    {
+      std::shared_lock lock(mutex_);
+      if (const auto it = values_.find(k); it != values_.end()) {
+        return it->second;
+      }
+    }
+
+    const auto value = boost::math::cdf(dist_, k);
+    std::unique_lock lock(mutex_);
+    values_.emplace(k, value);
+    return value;
+  }
+
+ private:
+  const boost::math::binomial_distribution<double> dist_;
+  std::shared_mutex mutex_;
+  std::unordered_map<uint64_t, double> values_;
+};
+
+// Stake, total votes count and threshold are fixed per period, so tables are reused by all votes of the period
+constexpr size_t kMaxBinomialCdfTables = 10000;
+std::mutex binomial_cdf_tables_mutex;
+std::map<std::pair<uint64_t, double>, std::shared_ptr<BinomialCdfTable>> binomial_cdf_tables;
+
+std::shared_ptr<BinomialCdfTable> getBinomialCdfTable(uint64_t trials, double probability) {
+  std::unique_lock lock(binomial_cdf_tables_mutex);
+  if (const auto it = binomial_cdf_tables.find({trials, probability}); it != binomial_cdf_tables.end()) {
+    return it->second;
+  }
+
+  if (binomial_cdf_tables.size() >= kMaxBinomialCdfTables) {
+    binomial_cdf_tables.clear();
+  }
+  auto table = std::make_shared<BinomialCdfTable>(trials, probability);
+  binomial_cdf_tables.emplace(std::make_pair(trials, probability), table);
+  return table;
+}
+
+}  // namespace
+
 uint64_t VrfPbftSortition::getBinominalDistribution(uint64_t stake, double dpos_total_votes_count, double threshold,
                                                     const uint256_t& hash) {
   if (!stake) return 0;  // Stake is 0
@@ -71,14 +128,14 @@ uint64_t VrfPbftSortition::getBinominalDistribution(uint64_t stake, double dpos_
   const auto l = static_cast<uint256_t>(hash).convert_to<boost::multiprecision::mpfr_float>();
   auto division = l / kMax256bFP;
   const double ratio = division.convert_to<double>();
-  boost::math::binomial_distribution<double> dist(static_cast<double>(stake), threshold / dpos_total_votes_count);
+  const auto cdf_table = getBinomialCdfTable(stake, threshold / dpos_total_votes_count);
 
   // Binary search for find the lowest stake <= cdf
   uint64_t start = 0;
   uint64_t end = stake - 1;
   while (start + 1 < end) {
     const auto mid = start + (end - start) / 2;
-    const auto target = cdf(dist, mid);
+    const auto target = cdf_table->cdf(mid);
     if (ratio <= target) {
       end = mid;
     } else {
@@ -86,8 +143,8 @@ uint64_t VrfPbftSortition::getBinominalDistribution(uint64_t stake, double dpos_
     }
   }
   // Found the correct boundary
-  if (ratio <= cdf(dist, start)) return start;
-  if (ratio <= cdf(dist, end)) return end;
+  if (ratio <= cdf_table->cdf(start)) return start;
+  if (ratio <= cdf_table->cdf(end)) return end;
   return stake;
 }
 
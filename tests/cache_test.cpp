@@ -11,27 +11,22 @@ struct CacheTest : WithDataDir {};
 // Cache for testing. Value is equal to block number(key == value)
 class ValueCacheTestable : public ValueByBlockCache<uint64_t> {
  public:
-  ValueCacheTestable(uint64_t limit) : ValueByBlockCache<uint64_t>(limit, [](uint64_t a) { return a; }) {}
-  uint64_t blocksSize() { return data_by_block_.size(); }
+  ValueCacheTestable(uint64_t limit, size_t max_size = kDefaultBlockCacheMaxSize)
+      : ValueByBlockCache<uint64_t>(limit, [](uint64_t a) { return a; }, max_size) {}
+  uint64_t blocksSize() { return cache_.stats().entries; }
 
-  bool haveBlock(uint64_t block) { return data_by_block_.contains(block); }
+  bool haveBlock(uint64_t block) { return cache_.contains(block, {}); }
 };
 
 class MapCacheTestable : public MapByBlockCache<uint64_t, uint64_t> {
  public:
-  MapCacheTestable(uint64_t limit)
-      : MapByBlockCache<uint64_t, uint64_t>(limit, [](uint64_t a, uint64_t) { return a; }) {}
-  uint64_t blocksSize() { return data_by_block_.size(); }
-
-  bool haveBlock(uint64_t block) { return data_by_block_.contains(block); }
-
-  bool contains(uint64_t block, uint64_t key) {
-    auto block_data = data_by_block_.find(block);
-    if (block_data != data_by_block_.end()) {
-      return block_data->second.contains(key);
-    }
-    return false;
-  }
+  MapCacheTestable(uint64_t limit, size_t max_size = kDefaultBlockCacheMaxSize)
+      : MapByBlockCache<uint64_t, uint64_t>(limit, [](uint64_t a, uint64_t) { return a; }, max_size) {}
+  uint64_t blocksSize() { return cache_.stats().entries; }
+
+  bool haveBlock(uint64_t block) { return cache_.containsBlock(block); }
+
+  bool contains(uint64_t block, uint64_t key) { return cache_.contains(block, key); }
 };
 
 TEST_F(CacheTest, value_caching) {
@@ -41,37 +36,50 @@ TEST_F(CacheTest, value_caching) {
   EXPECT_EQ(cache.get(1), 1);
   EXPECT_TRUE(cache.haveBlock(1));
   EXPECT_EQ(cache.blocksSize(), 1);
+  EXPECT_EQ(cache.last(), 1);
+  EXPECT_EQ(cache.lastBlockNum(), 1);
 }
 
-TEST_F(CacheTest, value_overwrite) {
+TEST_F(CacheTest, value_old_blocks) {
   ValueCacheTestable cache(3);
 
   EXPECT_EQ(cache.get(1), 1);
   EXPECT_EQ(cache.get(2), 2);
-  EXPECT_EQ(cache.get(3), 3);
+  EXPECT_EQ(cache.get(10), 10);
   EXPECT_TRUE(cache.haveBlock(1));
   EXPECT_TRUE(cache.haveBlock(2));
-  EXPECT_TRUE(cache.haveBlock(3));
-  EXPECT_EQ(cache.blocksSize(), 3);
-
-  EXPECT_EQ(cache.get(4), 4);
-  EXPECT_FALSE(cache.haveBlock(1));
-  EXPECT_TRUE(cache.haveBlock(2));
+  EXPECT_TRUE(cache.haveBlock(10));
   EXPECT_EQ(cache.blocksSize(), 3);
 
   // Should return correct value, but not save it because it is too old
-  EXPECT_EQ(cache.get(1), 1);
-  EXPECT_FALSE(cache.haveBlock(1));
-  EXPECT_TRUE(cache.haveBlock(2));
-  EXPECT_EQ(cache.blocksSize(), 3);
-
   EXPECT_EQ(cache.get(5), 5);
+  EXPECT_FALSE(cache.haveBlock(5));
+  EXPECT_EQ(cache.get(7), 7);
+  EXPECT_TRUE(cache.haveBlock(7));
+  EXPECT_EQ(cache.blocksSize(), 4);
+  EXPECT_EQ(cache.last(), 10);
+}
+
+TEST_F(CacheTest, value_size_limit) {
+  constexpr size_t kMaxSize = 16 * 1024;
+  constexpr size_t kBlocks = 10000;
+  ValueCacheTestable cache(kBlocks, kMaxSize);
+
+  for (uint64_t block = 1; block <= kBlocks; ++block) {
+    EXPECT_EQ(cache.get(block), block);
+    // Recently used block is not evicted while other entries of its shard are
+    EXPECT_EQ(cache.get(1), 1);
+  }
+  EXPECT_TRUE(cache.haveBlock(1));
+  EXPECT_TRUE(cache.haveBlock(kBlocks));
   EXPECT_FALSE(cache.haveBlock(2));
-  EXPECT_TRUE(cache.haveBlock(3));
-  EXPECT_EQ(cache.blocksSize(), 3);
+  EXPECT_LT(cache.blocksSize(), kBlocks);
 
-  EXPECT_EQ(cache.get(10), 10);
-  EXPECT_EQ(cache.blocksSize(), 3);
+  const auto stats = cache.stats();
+  EXPECT_LE(stats.size, kMaxSize);
+  EXPECT_EQ(stats.entries, cache.blocksSize());
+  EXPECT_EQ(stats.misses, kBlocks);
+  EXPECT_EQ(stats.hits, kBlocks);
 }
 
 TEST_F(CacheTest, map_caching) {
@@ -86,40 +94,48 @@ TEST_F(CacheTest, map_caching) {
 
   EXPECT_EQ(cache.get(1, 2), 1);
   EXPECT_TRUE(cache.haveBlock(1));
-  EXPECT_EQ(cache.blocksSize(), 1);
+  EXPECT_EQ(cache.blocksSize(), 2);
   EXPECT_TRUE(cache.contains(1, 1));
   EXPECT_TRUE(cache.contains(1, 2));
+
+  EXPECT_EQ(cache.get(1, 2), 1);
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 2);
 }
 
-TEST_F(CacheTest, map_overwrite) {
+TEST_F(CacheTest, map_old_blocks) {
   MapCacheTestable cache(3);
 
   EXPECT_EQ(cache.get(1, 1), 1);
   EXPECT_EQ(cache.get(2, 2), 2);
-  EXPECT_EQ(cache.get(3, 3), 3);
+  EXPECT_EQ(cache.get(10, 10), 10);
   EXPECT_TRUE(cache.haveBlock(1));
   EXPECT_TRUE(cache.haveBlock(2));
-  EXPECT_TRUE(cache.haveBlock(3));
-  EXPECT_EQ(cache.blocksSize(), 3);
-
-  EXPECT_EQ(cache.get(4, 4), 4);
-  EXPECT_FALSE(cache.haveBlock(1));
-  EXPECT_TRUE(cache.haveBlock(2));
-  EXPECT_EQ(cache.blocksSize(), 3);
+  EXPECT_TRUE(cache.haveBlock(10));
+  EXPECT_EQ(cache.lastBlockNum(), 10);
 
   // Should return correct value, but not save it because it is too old
-  EXPECT_EQ(cache.get(1, 1), 1);
-  EXPECT_FALSE(cache.haveBlock(1));
-  EXPECT_TRUE(cache.haveBlock(2));
-  EXPECT_EQ(cache.blocksSize(), 3);
-
   EXPECT_EQ(cache.get(5, 5), 5);
-  EXPECT_FALSE(cache.haveBlock(2));
-  EXPECT_TRUE(cache.haveBlock(3));
-  EXPECT_EQ(cache.blocksSize(), 3);
+  EXPECT_FALSE(cache.haveBlock(5));
+  EXPECT_EQ(cache.get(7, 7), 7);
+  EXPECT_TRUE(cache.contains(7, 7));
+  EXPECT_EQ(cache.blocksSize(), 4);
+}
 
-  EXPECT_EQ(cache.get(10, 10), 10);
-  EXPECT_EQ(cache.blocksSize(), 3);
+TEST_F(CacheTest, map_size_limit) {
+  constexpr size_t kMaxSize = 16 * 1024;
+  constexpr size_t kKeys = 10000;
+  MapCacheTestable cache(1, kMaxSize);
+
+  for (uint64_t key = 1; key <= kKeys; ++key) {
+    EXPECT_EQ(cache.get(1, key), 1);
+    EXPECT_EQ(cache.get(1, 1), 1);
+  }
+  EXPECT_TRUE(cache.contains(1, 1));
+  EXPECT_TRUE(cache.contains(1, kKeys));
+  EXPECT_FALSE(cache.contains(1, 2));
+  EXPECT_LE(cache.stats().size, kMaxSize);
 }
 
 }  // namespace taraxa::final_chain
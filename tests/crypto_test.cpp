@@ -5,6 +5,7 @@
 #include <libdevcrypto/Common.h>
 #include <openssl/bn.h>
 
+#include <boost/math/distributions/binomial.hpp>
 #include <iostream>
 #include <string>
 
@@ -341,6 +342,48 @@ TEST_F(CryptoTest, binomial_distribution) {
   }
 }
 
+// Reference implementation evaluating binomial cdf directly for every call
+uint64_t referenceBinominalDistribution(uint64_t stake, double dpos_total_votes_count, double threshold,
+                                       const uint256_t& hash) {
+  if (!stake) return 0;
+
+  const auto l = static_cast<uint256_t>(hash).convert_to<boost::multiprecision::mpfr_float>();
+  const double ratio = (l / VrfPbftSortition::kMax256bFP).convert_to<double>();
+  boost::math::binomial_distribution<double> dist(static_cast<double>(stake), threshold / dpos_total_votes_count);
+
+  uint64_t start = 0;
+  uint64_t end = stake - 1;
+  while (start + 1 < end) {
+    const auto mid = start + (end - start) / 2;
+    if (ratio <= cdf(dist, mid)) {
+      end = mid;
+    } else {
+      start = mid;
+    }
+  }
+  if (ratio <= cdf(dist, start)) return start;
+  if (ratio <= cdf(dist, end)) return end;
+  return stake;
+}
+
+TEST_F(CryptoTest, binomial_distribution_cdf_tables_equivalence) {
+  const std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> params{
+      {1, 100, 5}, {2, 3, 3}, {100, 200, 20}, {1000, 1000, 1000}, {12345, 1000000, 1000}, {5000000, 10000000, 1000}};
+  for (const auto& [stake, total, threshold] : params) {
+    // Every table is queried repeatedly, so both computed and cached values are compared
+    for (uint32_t i = 0; i < 500; i++) {
+      const uint256_t hash = dev::FixedHash<32>::random();
+      EXPECT_EQ(VrfPbftSortition::getBinominalDistribution(stake, total, threshold, hash),
+                referenceBinominalDistribution(stake, total, threshold, hash));
+    }
+    // Boundary hashes
+    for (const uint256_t& hash : {uint256_t(0), uint256_t(1), VrfPbftSortition::max256bits}) {
+      EXPECT_EQ(VrfPbftSortition::getBinominalDistribution(stake, total, threshold, hash),
+                referenceBinominalDistribution(stake, total, threshold, hash));
+    }
+  }
+}
+
 TEST_F(CryptoTest, leader_selection) {
   std::unordered_map<uint64_t, vrf_sk_t> low_stake_nodes;
   std::unordered_map<uint64_t, vrf_sk_t> high_stake_nodes;
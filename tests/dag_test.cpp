@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <functional>
+#include <random>
+
 #include "common/static_init.hpp"
 #include "common/types.hpp"
 #include "dag/dag_manager.hpp"
@@ -441,6 +445,108 @@ TEST_F(DagTest, get_latest_pivot_tips) {
   EXPECT_EQ(ret->second[0], blk_hash_t("0000000000000000000000000000000000000000000000000000000000000006"));
 }
 
+TEST_F(DagTest, ghost_path_reference) {
+  const blk_hash_t genesis(1);
+  PivotTree pivot_tree(genesis, addr_t());
+
+  // Random pivot tree, each vertex points to random earlier vertex
+  std::mt19937 gen(7);
+  std::vector<blk_hash_t> vertices{genesis};
+  std::unordered_map<blk_hash_t, std::vector<blk_hash_t>> children;
+  for (uint32_t i = 0; i < 2000; i++) {
+    std::uniform_int_distribution<size_t> dist(vertices.size() > 50 ? vertices.size() - 50 : 0, vertices.size() - 1);
+    const auto pivot = vertices[dist(gen)];
+    const blk_hash_t hash(i + 2);
+    pivot_tree.addVEEs(hash, pivot, {});
+    children[pivot].push_back(hash);
+    vertices.push_back(hash);
+  }
+
+  // Reference ghost path with subtree weights computed from scratch
+  std::function<size_t(const blk_hash_t &)> weight = [&](const blk_hash_t &v) {
+    size_t w = 1;
+    for (const auto &child : children[v]) {
+      w += weight(child);
+    }
+    return w;
+  };
+  for (const auto &root : {vertices[0], vertices[10], vertices[500]}) {
+    std::vector<blk_hash_t> expected{root};
+    while (!children[expected.back()].empty()) {
+      const auto &childs = children[expected.back()];
+      auto heaviest = childs.front();
+      for (const auto &child : childs) {
+        if (const auto w = weight(child), hw = weight(heaviest); w > hw || (w == hw && child < heaviest)) {
+          heaviest = child;
+        }
+      }
+      expected.push_back(heaviest);
+    }
+    EXPECT_EQ(pivot_tree.getGhostPath(root), expected);
+  }
+}
+
+TEST_F(DagTest, DISABLED_dag_traversal_performance) {
+  constexpr uint32_t kVertices = 100000;
+  constexpr uint32_t kLevelWidth = 10;
+  constexpr uint32_t kIterations = 10;
+  const blk_hash_t genesis(1);
+  Dag total_dag(genesis, addr_t());
+  PivotTree pivot_tree(genesis, addr_t());
+
+  // Every level has kLevelWidth blocks, each pointing with pivot and up to two tips to the previous level
+  std::mt19937 gen(1);
+  std::map<uint64_t, std::unordered_set<blk_hash_t>> non_finalized_blks;
+  std::vector<blk_hash_t> previous_level{genesis};
+  std::vector<blk_hash_t> current_level;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < kVertices; i++) {
+    const blk_hash_t hash(i + 2);
+    std::uniform_int_distribution<size_t> dist(0, previous_level.size() - 1);
+    const auto &pivot = previous_level[dist(gen)];
+    std::vector<blk_hash_t> tips;
+    for (size_t j = 0; j < 2; j++) {
+      if (const auto &tip = previous_level[dist(gen)]; tip != pivot) {
+        tips.push_back(tip);
+      }
+    }
+    total_dag.addVEEs(hash, pivot, tips);
+    pivot_tree.addVEEs(hash, pivot, {});
+    non_finalized_blks[i / kLevelWidth + 1].insert(hash);
+    current_level.push_back(hash);
+    if (current_level.size() == kLevelWidth) {
+      previous_level = std::move(current_level);
+      current_level.clear();
+    }
+  }
+  std::cout << "Insertion of " << kVertices << " vertices: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()
+            << " ms" << std::endl;
+
+  std::vector<blk_hash_t> ghost_path;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < kIterations; i++) {
+    ghost_path = pivot_tree.getGhostPath(genesis);
+  }
+  std::cout << "getGhostPath: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() /
+                   kIterations
+            << " us" << std::endl;
+  ASSERT_FALSE(ghost_path.empty());
+
+  std::vector<blk_hash_t> order;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < kIterations; i++) {
+    EXPECT_TRUE(total_dag.computeOrder(ghost_path.back(), order, non_finalized_blks));
+  }
+  std::cout << "computeOrder of " << order.size() << " vertices: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() /
+                   kIterations
+            << " us" << std::endl;
+  ASSERT_FALSE(order.empty());
+  EXPECT_EQ(order.back(), ghost_path.back());
+}
+
 }  // namespace taraxa::core_tests
 
 using namespace taraxa;
@@ -1,12 +1,16 @@
 #include "final_chain/final_chain.hpp"
 
+#include <chrono>
+#include <future>
 #include <optional>
+#include <random>
 #include <vector>
 
 #include "common/constants.hpp"
 #include "common/vrf_wrapper.hpp"
 #include "config/config.hpp"
 #include "final_chain/trie_common.hpp"
+#include "network/rpc/eth/LogsQueryEngine.hpp"
 #include "test_util/gtest.hpp"
 #include "test_util/samples.hpp"
 #include "test_util/test_util.hpp"
@@ -333,6 +337,46 @@ TEST_F(FinalChainTest, nonce_test) {
   advance({trx5}, {false, false, true});
 }
 
+TEST_F(FinalChainTest, queued_finalization) {
+  init();
+  constexpr size_t kBlocksCount = 10;
+  std::vector<uint64_t> published_blocks;
+  SUT->block_finalized_.subscribe([&](const std::shared_ptr<FinalizationResult>& res) {
+    // Block is published only once it is durable and its state is committed
+    EXPECT_EQ(SUT->last_block_number(), res->final_chain_blk->number);
+    EXPECT_TRUE(db->exist(res->final_chain_blk->number, DB::Columns::final_chain_receipts_by_blk_number));
+    published_blocks.push_back(res->final_chain_blk->number);
+  });
+
+  // Periods are queued without waiting for finalization of the previous ones and are finalized in order
+  std::vector<std::future<std::shared_ptr<const FinalizationResult>>> results;
+  for (size_t i = 0; i < kBlocksCount; ++i) {
+    DagBlock dag_blk({}, {}, {}, {}, {}, {}, secret_t::random());
+    db->saveDagBlock(dag_blk);
+    auto pbft_block = std::make_shared<PbftBlock>(kNullBlockHash, kNullBlockHash, kNullBlockHash, kNullBlockHash,
+                                                  i + 1, addr_t::random(), dev::KeyPair::create().secret(),
+                                                  std::vector<vote_hash_t>{});
+    std::vector<std::shared_ptr<Vote>> votes;
+    PeriodData period_data(pbft_block, votes);
+    period_data.dag_blocks.push_back(dag_blk);
+    results.emplace_back(SUT->finalize(std::move(period_data), {dag_blk.getHash()}));
+  }
+
+  for (size_t i = 0; i < kBlocksCount; ++i) {
+    const auto& blk_h = *results[i].get()->final_chain_blk;
+    EXPECT_EQ(blk_h.number, i + 1);
+    EXPECT_EQ(blk_h.parent_hash, SUT->block_header(i)->hash);
+    EXPECT_EQ(util::rlp_enc(blk_h), util::rlp_enc(*SUT->block_header(blk_h.number)));
+  }
+  EXPECT_EQ(SUT->last_block_number(), kBlocksCount);
+
+  // Blocks are published in the order of finalization
+  ASSERT_EQ(published_blocks.size(), kBlocksCount);
+  for (size_t i = 0; i < kBlocksCount; ++i) {
+    EXPECT_EQ(published_blocks[i], i + 1);
+  }
+}
+
 TEST_F(FinalChainTest, nonce_skipping) {
   auto sender_keys = dev::KeyPair::create();
   const auto& addr = sender_keys.address();
@@ -481,6 +525,191 @@ TEST_F(FinalChainTest, failed_transaction_fee) {
   }
 }
 
+TEST_F(FinalChainTest, log_blooms_index) {
+  init();
+  // Spans several chunks of the lowest level, so both cached tip chunks and chunks in db are queried
+  constexpr size_t kBlocksCount = 40;
+  for (size_t i = 0; i < kBlocksCount; ++i) {
+    advance({});
+  }
+
+  auto author_bloom = [](const addr_t& author) {
+    LogBloom bloom;
+    bloom.shiftBloom<3>(sha3(author.ref()));
+    return bloom;
+  };
+  const auto last_block = SUT->last_block_number();
+  ASSERT_EQ(last_block, kBlocksCount);
+  std::map<EthBlockNumber, std::vector<EthBlockNumber>> found_blocks;
+  for (EthBlockNumber n : {uint64_t(1), uint64_t(15), uint64_t(16), uint64_t(31), last_block}) {
+    const auto blocks = SUT->withBlockBloom(author_bloom(SUT->block_header(n)->author), 0, last_block);
+    EXPECT_NE(std::find(blocks.begin(), blocks.end(), n), blocks.end()) << n;
+    found_blocks[n] = blocks;
+  }
+
+  // Fresh instance reads all the chunks from db
+  SUT = nullptr;
+  SUT = NewFinalChain(db, cfg);
+  for (const auto& [n, blocks] : found_blocks) {
+    EXPECT_EQ(SUT->withBlockBloom(author_bloom(SUT->block_header(n)->author), 0, last_block), blocks) << n;
+  }
+}
+
+TEST_F(FinalChainTest, block_receipts) {
+  auto sender_keys = dev::KeyPair::create();
+  cfg.genesis.state.initial_balances = {};
+  cfg.genesis.state.initial_balances[sender_keys.address()] = 100000000;
+  init();
+  // Init code that emits an empty log: PUSH1 0 PUSH1 0 LOG0 STOP
+  const auto log_emitting_code = dev::fromHex("0x60006000a000");
+  SharedTransactions trxs;
+  for (size_t nonce = 0; nonce < 3; ++nonce) {
+    trxs.emplace_back(std::make_shared<Transaction>(nonce, 0, 0, 100000, log_emitting_code, sender_keys.secret()));
+  }
+  const auto result = advance(trxs, {.dont_assume_no_logs = true});
+  advance({});
+
+  const auto receipts = SUT->block_receipts(result->final_chain_blk->number);
+  ASSERT_EQ(receipts.size(), trxs.size());
+  for (size_t i = 0; i < trxs.size(); ++i) {
+    ASSERT_TRUE(receipts[i]);
+    EXPECT_EQ(util::rlp_enc(*receipts[i]), util::rlp_enc(result->trx_receipts[i]));
+    EXPECT_EQ(util::rlp_enc(*receipts[i]), util::rlp_enc(*SUT->transaction_receipt(trxs[i]->getHash())));
+    EXPECT_EQ(receipts[i]->logs.size(), 1);
+  }
+  EXPECT_TRUE(SUT->block_receipts().empty());
+
+  // Block that is not in receipts by block column yet
+  auto batch = db->createWriteBatch();
+  db->remove(batch, DB::Columns::final_chain_receipts_by_blk_number, result->final_chain_blk->number);
+  db->commitWriteBatch(batch);
+  const auto fallback_receipts = SUT->block_receipts(result->final_chain_blk->number);
+  ASSERT_EQ(fallback_receipts.size(), trxs.size());
+  for (size_t i = 0; i < trxs.size(); ++i) {
+    ASSERT_TRUE(fallback_receipts[i]);
+    EXPECT_EQ(util::rlp_enc(*fallback_receipts[i]), util::rlp_enc(*receipts[i]));
+  }
+
+  // Missing receipt keeps its position, so the rest of receipts stay aligned with transactions
+  batch = db->createWriteBatch();
+  db->remove(batch, DB::Columns::final_chain_receipt_by_trx_hash, trxs[1]->getHash());
+  db->commitWriteBatch(batch);
+  const auto partial_receipts = SUT->block_receipts(result->final_chain_blk->number);
+  ASSERT_EQ(partial_receipts.size(), trxs.size());
+  EXPECT_FALSE(partial_receipts[1]);
+  ASSERT_TRUE(partial_receipts[2]);
+  EXPECT_EQ(util::rlp_enc(*partial_receipts[2]), util::rlp_enc(*receipts[2]));
+}
+
+TEST_F(FinalChainTest, logs_query_engine) {
+  auto sender_keys = dev::KeyPair::create();
+  cfg.genesis.state.initial_balances = {};
+  cfg.genesis.state.initial_balances[sender_keys.address()] = 100000000;
+  init();
+  // Init code that emits an empty log: PUSH1 0 PUSH1 0 LOG0 STOP
+  const auto log_emitting_code = dev::fromHex("0x60006000a000");
+  auto nonce = 0;
+  constexpr size_t kBlocksCount = 30;
+  for (size_t i = 0; i < kBlocksCount; ++i) {
+    SharedTransactions trxs;
+    for (size_t j = 0; j < i % 3; ++j) {
+      trxs.emplace_back(std::make_shared<Transaction>(nonce++, 0, 0, 100000, log_emitting_code, sender_keys.secret()));
+    }
+    advance(trxs, {.dont_assume_no_logs = true});
+  }
+
+  using namespace net::rpc::eth;
+  const auto log_ids = [](const std::vector<LocalisedLogEntry>& logs) {
+    std::vector<std::tuple<EthBlockNumber, h256, uint64_t, addr_t>> ret;
+    for (const auto& log : logs) {
+      ret.emplace_back(log.trx_loc.blk_n, log.trx_loc.trx_hash, log.position_in_receipt, log.le.address);
+    }
+    return ret;
+  };
+  const LogFilter all_logs(1, std::nullopt, {}, {});
+  const auto expected = all_logs.match_all(*SUT);
+  ASSERT_EQ(expected.size(), kBlocksCount);
+
+  LogsQueryConfig config;
+  config.threads = 3;
+  config.blocks_per_chunk = 4;
+  LogsQueryEngine engine(config);
+  EXPECT_EQ(log_ids(engine.query(all_logs, *SUT)), log_ids(expected));
+  const auto contract = *SUT->transaction_receipt(SUT->transaction_hashes(5)->get(0))->new_contract_address;
+  const LogFilter contract_logs(5, 20, {contract}, {});
+  const auto contract_logs_found = engine.query(contract_logs, *SUT);
+  ASSERT_EQ(contract_logs_found.size(), 1);
+  EXPECT_EQ(log_ids(contract_logs_found), log_ids(contract_logs.match_all(*SUT)));
+  EXPECT_TRUE(engine.query(LogFilter(20, 10, {}, {}), *SUT).empty());
+
+  config.max_block_range = 10;
+  config.max_results = 15;
+  LogsQueryEngine limited_engine(config);
+  EXPECT_EQ(limited_engine.query(LogFilter(1, 10, {}, {}), *SUT).size(), 9);
+  EXPECT_THROW(limited_engine.query(LogFilter(1, 11, {}, {}), *SUT), std::runtime_error);
+  config.max_block_range = 0;
+  LogsQueryEngine results_limited_engine(config);
+  EXPECT_THROW(results_limited_engine.query(all_logs, *SUT), std::runtime_error);
+
+  const auto stats = limited_engine.stats();
+  EXPECT_EQ(stats.queries, 2);
+  EXPECT_EQ(stats.rejected_queries, 1);
+}
+
+TEST_F(FinalChainTest, ordered_trie_root) {
+  std::mt19937 gen(1);
+  util::ThreadPool pool(4);
+  // Sizes around the boundaries of rlp encoded keys, nibble branches and the parallel task size
+  for (size_t count : {0, 1, 2, 15, 16, 17, 127, 128, 129, 255, 256, 257, 1000, 4097}) {
+    std::vector<bytes> values(count);
+    std::vector<dev::bytesConstRef> values_refs;
+    dev::BytesMap trie;
+    for (size_t i = 0; i < count; ++i) {
+      values[i].resize(gen() % 200);
+      for (auto &b : values[i]) b = gen();
+      values_refs.emplace_back(&values[i]);
+      trie[dev::rlp(i)] = values[i];
+    }
+    const auto expected_root = hash256(trie);
+    EXPECT_EQ(orderedTrieRoot(values_refs), expected_root) << count;
+    EXPECT_EQ(orderedTrieRoot(values_refs, &pool), expected_root) << count;
+  }
+}
+
+TEST_F(FinalChainTest, DISABLED_ordered_trie_root_performance) {
+  constexpr size_t kTransactions = 10000;
+  constexpr size_t kRuns = 20;
+  const auto transactions = samples::createSignedTrxSamples(0, kTransactions, dev::KeyPair::create().secret());
+  std::vector<dev::bytesConstRef> trxs_rlp;
+  for (const auto &trx : transactions) {
+    trxs_rlp.emplace_back(&trx->rlp());
+  }
+  util::ThreadPool pool;
+
+  auto measure = [&](auto &&compute_root) {
+    h256 root;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kRuns; ++i) {
+      root = compute_root();
+    }
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    return std::make_pair(root, duration / kRuns);
+  };
+  const auto [expected_root, hash256_time] = measure([&] {
+    dev::BytesMap trie;
+    for (size_t i = 0; i < transactions.size(); ++i) {
+      trie[dev::rlp(i)] = transactions[i]->rlp();
+    }
+    return hash256(trie);
+  });
+  const auto [root, parallel_time] = measure([&] { return orderedTrieRoot(trxs_rlp, &pool); });
+  EXPECT_EQ(root, expected_root);
+  std::cout << "Transactions root of " << kTransactions << " transactions, hash256: " << hash256_time
+            << " us, parallel orderedTrieRoot with " << pool.capacity() << " threads: " << parallel_time << " us"
+            << std::endl;
+}
+
 TEST_F(FinalChainTest, initial_validator_exceed_maximum_stake) {
   const dev::KeyPair key = dev::KeyPair::create();
   const dev::KeyPair validator_key = dev::KeyPair::create();
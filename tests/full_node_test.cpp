@@ -3,9 +3,13 @@
 #include <gtest/gtest.h>
 
 #include <atomic>
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <mutex>
+#include <random>
 #include <shared_mutex>
+#include <thread>
 #include <vector>
 
 #include "cli/config.hpp"
@@ -383,6 +387,393 @@ TEST_F(FullNodeTest, db_test) {
   EXPECT_FALSE(db.getProposalPeriodForDagLevel(107));
 }
 
+TEST_F(FullNodeTest, period_data_position_index) {
+  auto db_ptr = std::make_shared<DbStorage>(data_dir);
+  DagBlock blk1(blk_hash_t(1), 1, {}, {trx_hash_t(1), trx_hash_t(2)}, sig_t(777), blk_hash_t(0xB1), addr_t(999));
+  DagBlock blk2(blk_hash_t(1), 1, {}, {trx_hash_t(3), trx_hash_t(4)}, sig_t(777), blk_hash_t(0xB2), addr_t(999));
+  DagBlock blk3(blk_hash_t(0xB1), 2, {}, {trx_hash_t(5)}, sig_t(777), blk_hash_t(0xB6), addr_t(999));
+
+  PeriodData period_data(make_simple_pbft_block(blk_hash_t(1), 1), {});
+  period_data.dag_blocks = {blk1, blk2};
+  for (size_t i = 0; i < 5; i++) {
+    period_data.transactions.push_back(g_trx_signed_samples[i]);
+  }
+  auto batch = db_ptr->createWriteBatch();
+  db_ptr->savePeriodData(period_data, batch);
+  db_ptr->commitWriteBatch(batch);
+
+  // Period stored in the previous layout, with dag blocks and transactions inside of period_data entry
+  PeriodData legacy_period_data(make_simple_pbft_block(blk_hash_t(2), 2), {});
+  legacy_period_data.dag_blocks = {blk3};
+  legacy_period_data.transactions = {g_trx_signed_samples[5], g_trx_signed_samples[6]};
+  batch = db_ptr->createWriteBatch();
+  db_ptr->addDagBlockPeriodToBatch(blk3.getHash(), 2, 0, batch);
+  db_ptr->addTransactionPeriodToBatch(batch, g_trx_signed_samples[5]->getHash(), 2, 0);
+  db_ptr->addTransactionPeriodToBatch(batch, g_trx_signed_samples[6]->getHash(), 2, 1);
+  db_ptr->insert(batch, DB::Columns::period_data, PbftPeriod(2), legacy_period_data.rlp());
+  db_ptr->commitWriteBatch(batch);
+  db_ptr->saveStatusField(StatusDbField::PeriodDataMigrated, 0);
+  // Migration interrupted after period 1 is resumed from period 2
+  db_ptr->saveStatusField(StatusDbField::PeriodDataMigratedPeriod, 2);
+
+  const auto check_period_data = [&](DbStorage &db) {
+    EXPECT_EQ(db.getPeriodDataRaw(1), period_data.rlp());
+    EXPECT_EQ(db.getPeriodDataRaw(2), legacy_period_data.rlp());
+    for (size_t i = 0; i < 7; i++) {
+      EXPECT_EQ(*db.getTransaction(g_trx_signed_samples[i]->getHash()), *g_trx_signed_samples[i]);
+    }
+    EXPECT_EQ(*db.getDagBlock(blk1.getHash()), blk1);
+    EXPECT_EQ(*db.getDagBlock(blk2.getHash()), blk2);
+    EXPECT_EQ(*db.getDagBlock(blk3.getHash()), blk3);
+    EXPECT_EQ(db.getFinalizedDagBlockHashesByPeriod(1), std::vector<blk_hash_t>({blk1.getHash(), blk2.getHash()}));
+    EXPECT_EQ(db.getPeriodTransactions(2)->size(), 2);
+    EXPECT_FALSE(db.getPeriodTransactions(3).has_value());
+
+    const auto [transactions, missing] = db.getFinalizedTransactions(
+        {g_trx_signed_samples[6]->getHash(), g_trx_signed_samples[3]->getHash(), g_trx_signed_samples[0]->getHash()});
+    ASSERT_TRUE(transactions.has_value());
+    ASSERT_EQ(transactions->size(), 3);
+    EXPECT_EQ(*(*transactions)[0], *g_trx_signed_samples[0]);
+    EXPECT_EQ(*(*transactions)[1], *g_trx_signed_samples[3]);
+    EXPECT_EQ(*(*transactions)[2], *g_trx_signed_samples[6]);
+  };
+
+  // Reopening db migrates the period stored in the previous layout
+  db_ptr.reset();
+  db_ptr = std::make_shared<DbStorage>(data_dir);
+  EXPECT_EQ(db_ptr->getStatusField(StatusDbField::PeriodDataMigrated), 1);
+  check_period_data(*db_ptr);
+}
+
+TEST_F(FullNodeTest, db_multi_lookup) {
+  auto db_ptr = std::make_shared<DbStorage>(data_dir);
+  auto &db = *db_ptr;
+
+  // Transactions 0-2 are non-finalized, 3-5 finalized in period 1 and 6-7 are unknown
+  for (size_t i = 0; i < 3; i++) {
+    db.saveTransaction(*g_trx_signed_samples[i]);
+  }
+  PeriodData period_data(make_simple_pbft_block(blk_hash_t(1), 1), {});
+  for (size_t i = 3; i < 6; i++) {
+    period_data.transactions.push_back(g_trx_signed_samples[i]);
+  }
+  auto batch = db.createWriteBatch();
+  db.savePeriodData(period_data, batch);
+  db.commitWriteBatch(batch);
+
+  // Keys are intentionally not sorted
+  std::vector<trx_hash_t> hashes;
+  for (size_t i : {7, 4, 0, 6, 5, 2, 3, 1}) {
+    hashes.push_back(g_trx_signed_samples[i]->getHash());
+  }
+  EXPECT_EQ(db.transactionsInDb(hashes), std::vector<bool>({false, true, true, false, true, true, true, true}));
+  EXPECT_EQ(db.transactionsFinalized(hashes), std::vector<bool>({false, true, false, false, true, false, true, false}));
+
+  const auto periods = db.getTransactionsPeriod(hashes);
+  ASSERT_EQ(periods.size(), hashes.size());
+  for (size_t i = 0; i < hashes.size(); i++) {
+    EXPECT_EQ(periods[i], db.getTransactionPeriod(hashes[i]));
+  }
+
+  const auto values = db.multiLookup(hashes, DB::Columns::transactions);
+  for (size_t i = 0; i < hashes.size(); i++) {
+    EXPECT_EQ(values[i], db.lookup(hashes[i], DB::Columns::transactions));
+  }
+  EXPECT_TRUE(db.multiLookup(std::vector<trx_hash_t>(), DB::Columns::transactions).empty());
+}
+
+TEST_F(FullNodeTest, db_group_commit) {
+  constexpr size_t kThreads = 8;
+  constexpr size_t kBatchesPerThread = 50;
+  auto db_ptr = std::make_shared<DbStorage>(data_dir);
+  db_ptr->setGroupCommitWindow(1000);
+  rocksdb::WriteOptions sync_write_options;
+  sync_write_options.sync = true;
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t] {
+      for (size_t i = 0; i < kBatchesPerThread; i++) {
+        auto batch = db_ptr->createWriteBatch();
+        db_ptr->insert(batch, DB::Columns::final_chain_meta, uint64_t(t * kBatchesPerThread + i), uint64_t(t));
+        db_ptr->commitWriteBatch(batch, sync_write_options);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::promise<bool> committed;
+  auto batch = db_ptr->createWriteBatch();
+  db_ptr->insert(batch, DB::Columns::final_chain_meta, uint64_t(kThreads * kBatchesPerThread), uint64_t(kThreads));
+  db_ptr->commitWriteBatchAsync(std::move(batch),
+                                [&committed](rocksdb::Status const &status) { committed.set_value(status.ok()); });
+  EXPECT_TRUE(committed.get_future().get());
+
+  for (size_t t = 0; t <= kThreads; t++) {
+    for (size_t i = 0; i < (t < kThreads ? kBatchesPerThread : 1); i++) {
+      EXPECT_EQ(db_ptr->lookup_int<uint64_t>(uint64_t(t * kBatchesPerThread + i), DB::Columns::final_chain_meta), t);
+    }
+  }
+  const auto stats = db_ptr->getGroupCommitStats();
+  EXPECT_EQ(stats.batches, kThreads * kBatchesPerThread + 1);
+  // Concurrent sync batches share WAL syncs
+  EXPECT_LT(stats.syncs, stats.batches);
+}
+
+TEST_F(FullNodeTest, history_pruning) {
+  constexpr PbftPeriod kPeriods = 250;
+  auto db_ptr = std::make_shared<DbStorage>(data_dir);
+  for (PbftPeriod period = 1; period <= kPeriods; period++) {
+    PeriodData period_data(make_simple_pbft_block(blk_hash_t(period), period), {});
+    auto batch = db_ptr->createWriteBatch();
+    db_ptr->savePeriodData(period_data, batch);
+    db_ptr->insert(batch, DB::Columns::final_chain_transaction_hashes_by_blk_number, EthBlockNumber(period),
+                   trx_hash_t(period).asBytes());
+    db_ptr->insert(batch, DB::Columns::final_chain_receipt_by_trx_hash, trx_hash_t(period), dev::bytes{1});
+    db_ptr->commitWriteBatch(batch);
+  }
+
+  const auto check_pruned = [&](DbStorage &db, PbftPeriod end_period) {
+    EXPECT_HAPPENS({10s, 100ms}, [&](auto &ctx) {
+      WAIT_EXPECT_EQ(ctx, db.getStatusField(StatusDbField::HistoryPrunedPeriod), end_period)
+    });
+    for (PbftPeriod period = 1; period <= kPeriods; period++) {
+      EXPECT_EQ(db.getPbftBlock(period).has_value(), period >= end_period);
+      EXPECT_EQ(db.exist(trx_hash_t(period), DB::Columns::final_chain_receipt_by_trx_hash), period >= end_period);
+    }
+  };
+
+  db_ptr->clearPeriodDataHistory(150);
+  check_pruned(*db_ptr, 150);
+  // Lower target than already scheduled one is ignored
+  db_ptr->clearPeriodDataHistory(120);
+  check_pruned(*db_ptr, 150);
+
+  // Deletion interrupted by shutdown is resumed after restart
+  db_ptr->clearPeriodDataHistory(230);
+  db_ptr.reset();
+  db_ptr = std::make_shared<DbStorage>(data_dir);
+  EXPECT_EQ(db_ptr->getStatusField(StatusDbField::HistoryPruningTarget), 230);
+  check_pruned(*db_ptr, 230);
+}
+
+TEST_F(FullNodeTest, block_receipts_migration) {
+  auto db_ptr = std::make_shared<DbStorage>(data_dir);
+  EXPECT_EQ(db_ptr->getStatusField(StatusDbField::BlockReceiptsMigrated), 1);
+
+  // Blocks finalized before receipts were stored by block, receipts of block 2 were already pruned
+  const auto make_receipt = [](uint64_t gas_used) {
+    final_chain::TransactionReceipt receipt;
+    receipt.status_code = 1;
+    receipt.gas_used = gas_used;
+    receipt.logs.push_back({addr_t(gas_used), {h256(gas_used)}, dev::bytes{1, 2, 3}});
+    return util::rlp_enc(receipt);
+  };
+  auto batch = db_ptr->createWriteBatch();
+  auto hashes = trx_hash_t(1).asBytes();
+  const auto second_hash = trx_hash_t(2).asBytes();
+  hashes.insert(hashes.end(), second_hash.begin(), second_hash.end());
+  db_ptr->insert(batch, DB::Columns::final_chain_transaction_hashes_by_blk_number, EthBlockNumber(1), hashes);
+  db_ptr->insert(batch, DB::Columns::final_chain_receipt_by_trx_hash, trx_hash_t(1), make_receipt(1));
+  db_ptr->insert(batch, DB::Columns::final_chain_receipt_by_trx_hash, trx_hash_t(2), make_receipt(2));
+  db_ptr->insert(batch, DB::Columns::final_chain_transaction_hashes_by_blk_number, EthBlockNumber(2),
+                 trx_hash_t(3).asBytes());
+  db_ptr->insert(batch, DB::Columns::final_chain_transaction_hashes_by_blk_number, EthBlockNumber(3), dev::bytes());
+  db_ptr->commitWriteBatch(batch);
+  db_ptr->saveStatusField(StatusDbField::BlockReceiptsMigrated, 0);
+
+  // Reopening db fills receipts by block from receipts by transaction hash in the background
+  db_ptr.reset();
+  db_ptr = std::make_shared<DbStorage>(data_dir);
+  EXPECT_HAPPENS({10s, 100ms}, [&](auto &ctx) {
+    WAIT_EXPECT_EQ(ctx, db_ptr->getStatusField(StatusDbField::BlockReceiptsMigrated), 1)
+  });
+  dev::RLPStream expected(2);
+  expected.appendRaw(make_receipt(1));
+  expected.appendRaw(make_receipt(2));
+  EXPECT_EQ(dev::asBytes(db_ptr->lookup(EthBlockNumber(1), DB::Columns::final_chain_receipts_by_blk_number)),
+            expected.out());
+  EXPECT_FALSE(db_ptr->exist(EthBlockNumber(2), DB::Columns::final_chain_receipts_by_blk_number));
+  EXPECT_EQ(dev::asBytes(db_ptr->lookup(EthBlockNumber(3), DB::Columns::final_chain_receipts_by_blk_number)),
+            dev::RLPStream(0).out());
+}
+
+TEST_F(FullNodeTest, DISABLED_block_logs_scan_performance) {
+  constexpr EthBlockNumber kBlocks = 100000;
+  constexpr size_t kTransactionsPerBlock = 4;
+  auto db_ptr = std::make_shared<DbStorage>(data_dir);
+
+  final_chain::TransactionReceipt receipt;
+  receipt.status_code = 1;
+  receipt.gas_used = 21000;
+  receipt.logs.assign(2, {addr_t(1), {h256(1), h256(2)}, dev::bytes(64, 1)});
+  const auto receipt_rlp = util::rlp_enc(receipt);
+  for (EthBlockNumber blk_n = 1; blk_n <= kBlocks;) {
+    auto batch = db_ptr->createWriteBatch();
+    for (size_t i = 0; i < 1000; ++i, ++blk_n) {
+      dev::bytes hashes;
+      for (size_t trx = 0; trx < kTransactionsPerBlock; ++trx) {
+        const auto hash = dev::sha3(dev::rlpList(blk_n, trx));
+        hashes.insert(hashes.end(), hash.begin(), hash.end());
+        db_ptr->insert(batch, DB::Columns::final_chain_receipt_by_trx_hash, hash, receipt_rlp);
+      }
+      db_ptr->insert(batch, DB::Columns::final_chain_transaction_hashes_by_blk_number, blk_n, hashes);
+    }
+    db_ptr->commitWriteBatch(batch);
+  }
+
+  // Backfill of the existing blocks
+  db_ptr->saveStatusField(StatusDbField::BlockReceiptsMigrated, 0);
+  db_ptr.reset();
+  auto start = std::chrono::steady_clock::now();
+  db_ptr = std::make_shared<DbStorage>(data_dir);
+  while (!db_ptr->getStatusField(StatusDbField::BlockReceiptsMigrated)) {
+    std::this_thread::sleep_for(10ms);
+  }
+  std::cout << "Receipts of " << kBlocks << " blocks migrated in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()
+            << " ms" << std::endl;
+
+  const auto measure = [&](const char *name, auto &&read_block_logs) {
+    size_t logs_count = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (EthBlockNumber blk_n = 1; blk_n <= kBlocks; ++blk_n) {
+      logs_count += read_block_logs(blk_n);
+    }
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(logs_count, kBlocks * kTransactionsPerBlock * receipt.logs.size());
+    std::cout << "Logs scan of " << kBlocks << " blocks by " << name << ": " << duration << " ms" << std::endl;
+  };
+  measure("receipt per transaction", [&](EthBlockNumber blk_n) {
+    const auto hashes = db_ptr->lookup(blk_n, DB::Columns::final_chain_transaction_hashes_by_blk_number);
+    size_t logs_count = 0;
+    for (size_t i = 0; i < hashes.size() / trx_hash_t::size; ++i) {
+      const trx_hash_t hash((uint8_t *)(hashes.data() + i * trx_hash_t::size), trx_hash_t::ConstructFromPointer);
+      final_chain::TransactionReceipt r;
+      r.rlp(dev::RLP(db_ptr->lookup(hash, DB::Columns::final_chain_receipt_by_trx_hash)));
+      logs_count += r.logs.size();
+    }
+    return logs_count;
+  });
+  measure("receipts per block", [&](EthBlockNumber blk_n) {
+    const auto raw = db_ptr->lookup(blk_n, DB::Columns::final_chain_receipts_by_blk_number);
+    size_t logs_count = 0;
+    for (const auto receipt_rlp : dev::RLP(raw)) {
+      final_chain::TransactionReceipt r;
+      r.rlp(receipt_rlp);
+      logs_count += r.logs.size();
+    }
+    return logs_count;
+  });
+}
+
+TEST_F(FullNodeTest, DISABLED_finalized_transaction_lookup_performance) {
+  constexpr size_t kPeriods = 20;
+  constexpr size_t kTransactionsPerPeriod = 5000;
+  constexpr size_t kLookups = 10000;
+  auto db_ptr = std::make_shared<DbStorage>(data_dir);
+  const auto transactions = samples::createSignedTrxSamples(0, kPeriods * kTransactionsPerPeriod, g_secret);
+
+  for (size_t period = 1; period <= kPeriods; period++) {
+    PeriodData period_data(make_simple_pbft_block(blk_hash_t(period), period), {});
+    for (size_t i = 0; i < kTransactionsPerPeriod; i++) {
+      period_data.transactions.push_back(transactions[(period - 1) * kTransactionsPerPeriod + i]);
+    }
+    auto batch = db_ptr->createWriteBatch();
+    db_ptr->savePeriodData(period_data, batch);
+    db_ptr->commitWriteBatch(batch);
+  }
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<size_t> dist(0, transactions.size() - 1);
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kLookups; i++) {
+    const auto &trx = transactions[dist(gen)];
+    ASSERT_EQ(db_ptr->getTransaction(trx->getHash())->getHash(), trx->getHash());
+  }
+  const auto duration =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "Finalized transaction lookup in periods with " << kTransactionsPerPeriod
+            << " transactions: " << duration / kLookups << " us" << std::endl;
+}
+
+TEST_F(FullNodeTest, DISABLED_db_column_profiles_performance) {
+  constexpr size_t kPeriods = 20;
+  constexpr size_t kTransactionsPerPeriod = 2000;
+  constexpr size_t kLookups = 20000;
+  const auto transactions = samples::createSignedTrxSamples(0, kPeriods * kTransactionsPerPeriod, g_secret);
+
+  // Every profile without any tuning corresponds to the options used before column profiles were introduced
+  DbColumnsConfig untuned;
+  for (auto &[name, profile] : untuned.profiles) {
+    profile = DbColumnProfileConfig();
+  }
+  DbColumnsConfig all_point_lookup;
+  for (const auto &col : DbStorage::Columns::all) {
+    all_point_lookup.column_profiles[col.name()] = DbColumnsConfig::kPointLookupProfile;
+  }
+  const std::vector<std::pair<std::string, DbColumnsConfig>> variants = {
+      {"untuned", untuned}, {"default", DbColumnsConfig()}, {"all_point_lookup", all_point_lookup}};
+
+  const auto elapsed_us = [](auto start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  };
+  for (const auto &[name, columns_config] : variants) {
+    const auto db_dir = data_dir / name;
+    auto db_ptr = std::make_shared<DbStorage>(db_dir, 0, 0, 0, 0, addr_t(), false, false, columns_config);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t period = 1; period <= kPeriods; period++) {
+      PeriodData period_data(make_simple_pbft_block(blk_hash_t(period), period), {});
+      for (size_t i = 0; i < kTransactionsPerPeriod; i++) {
+        period_data.transactions.push_back(transactions[(period - 1) * kTransactionsPerPeriod + i]);
+      }
+      auto batch = db_ptr->createWriteBatch();
+      db_ptr->savePeriodData(period_data, batch);
+      db_ptr->commitWriteBatch(batch);
+    }
+    const auto write_us = elapsed_us(start);
+
+    // Reopening moves all the data from memtables to sst files, so lookups go through filters and block cache
+    db_ptr.reset();
+    db_ptr = std::make_shared<DbStorage>(db_dir, 0, 0, 0, 0, addr_t(), false, false, columns_config);
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<size_t> trx_dist(0, transactions.size() - 1);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kLookups; i++) {
+      const auto &trx = transactions[trx_dist(gen)];
+      ASSERT_EQ(db_ptr->getTransaction(trx->getHash())->getHash(), trx->getHash());
+    }
+    const auto hit_us = elapsed_us(start);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kLookups; i++) {
+      ASSERT_FALSE(db_ptr->transactionInDb(trx_hash_t(i + 1)));
+    }
+    const auto miss_us = elapsed_us(start);
+
+    std::uniform_int_distribution<PbftPeriod> period_dist(1, kPeriods);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kLookups / kPeriods; i++) {
+      ASSERT_FALSE(db_ptr->getPeriodDataRaw(period_dist(gen)).empty());
+    }
+    const auto period_us = elapsed_us(start);
+
+    uint64_t db_size = 0;
+    for (const auto &entry : fs::recursive_directory_iterator(db_ptr->dbStoragePath())) {
+      if (entry.is_regular_file()) db_size += entry.file_size();
+    }
+
+    std::cout << "Column profiles " << name << ": write " << write_us / kPeriods << " us/period, hit lookup "
+              << hit_us / kLookups << " us, miss lookup " << miss_us / kLookups << " us, period read "
+              << period_us / (kLookups / kPeriods) << " us, db size " << (db_size >> 10) << " KB" << std::endl;
+  }
+}
+
 TEST_F(FullNodeTest, sync_five_nodes) {
   using namespace std;
 
@@ -2,7 +2,16 @@
 #include <libdevcore/Address.h>
 #include <libdevcore/Common.h>
 
+#include <chrono>
+#include <random>
+#include <sstream>
+
+#include "common/jsoncpp.hpp"
+#include "common/thread_pool.hpp"
+#include "network/http_server.hpp"
 #include "network/rpc/eth/Eth.h"
+#include "network/rpc/eth/LogsDispatcher.hpp"
+#include "network/rpc/jsonrpc_ws_server.hpp"
 #include "test_util/gtest.hpp"
 #include "test_util/samples.hpp"
 
@@ -215,6 +224,451 @@ TEST_F(RPCTest, eth_call) {
   }
 }
 
+namespace http = boost::beast::http;
+
+class EchoHttpProcessor : public net::HttpProcessor {
+ public:
+  Response process(const Request& request) override {
+    Response response;
+    response.result(http::status::ok);
+    response.body() = request.body();
+    response.prepare_payload();
+    return response;
+  }
+};
+
+std::string serializeHttpRequest(const std::string& target, const std::string& body, bool keep_alive = true) {
+  http::request<http::string_body> request{http::verb::post, target, 11};
+  request.set(http::field::content_type, "application/json");
+  request.body() = body;
+  request.keep_alive(keep_alive);
+  request.prepare_payload();
+  std::ostringstream serialized;
+  serialized << request;
+  return serialized.str();
+}
+
+TEST_F(RPCTest, http_keep_alive_and_pipelining) {
+  util::ThreadPool pool(4);
+  net::HttpServerConfig config;
+  config.max_requests_per_connection = 5;
+  const boost::asio::ip::tcp::endpoint ep{boost::asio::ip::address::from_string("127.0.0.1"), 7790};
+  auto server = std::make_shared<net::HttpServer>(pool.unsafe_get_io_context(), ep, addr_t(),
+                                                  std::make_shared<EchoHttpProcessor>(), config);
+  server->start();
+
+  boost::asio::io_context ioc;
+  boost::beast::tcp_stream stream(ioc);
+  stream.connect(ep);
+  boost::beast::flat_buffer buffer;
+
+  // Pipelined requests are answered in order over the same connection
+  std::string pipelined;
+  for (size_t i = 0; i < 3; ++i) {
+    pipelined += serializeHttpRequest("/", std::to_string(i));
+  }
+  boost::asio::write(stream, boost::asio::buffer(pipelined));
+  for (size_t i = 0; i < 3; ++i) {
+    http::response<http::string_body> response;
+    http::read(stream, buffer, response);
+    EXPECT_EQ(response.body(), std::to_string(i));
+    EXPECT_TRUE(response.keep_alive());
+  }
+
+  // Connection is closed after max requests per connection
+  for (size_t i = 3; i < 5; ++i) {
+    boost::asio::write(stream, boost::asio::buffer(serializeHttpRequest("/", std::to_string(i))));
+    http::response<http::string_body> response;
+    http::read(stream, buffer, response);
+    EXPECT_EQ(response.body(), std::to_string(i));
+    EXPECT_EQ(response.keep_alive(), i < 4);
+  }
+  http::response<http::string_body> response;
+  boost::system::error_code ec;
+  http::read(stream, buffer, response, ec);
+  EXPECT_EQ(ec, http::error::end_of_stream);
+
+  server->stop();
+}
+
+TEST_F(RPCTest, DISABLED_http_keep_alive_performance) {
+  constexpr size_t kRequests = 5000;
+  constexpr size_t kPipelineDepth = 16;
+  auto node_cfg = make_node_cfgs(1);
+  auto nodes = launch_nodes(node_cfg);
+  const boost::asio::ip::tcp::endpoint ep{node_cfg.front().network.rpc->address,
+                                          *node_cfg.front().network.rpc->http_port};
+  const auto body = R"({"jsonrpc":"2.0","method":"eth_blockNumber","params":[],"id":1})";
+
+  boost::asio::io_context ioc;
+  auto measure = [&](const std::string& name, auto&& send_requests) {
+    const auto start = std::chrono::steady_clock::now();
+    send_requests();
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << kRequests * 1000000 / std::max<int64_t>(duration, 1) << " requests/s" << std::endl;
+  };
+
+  measure("New connection per request", [&] {
+    for (size_t i = 0; i < kRequests; ++i) {
+      boost::beast::tcp_stream stream(ioc);
+      stream.connect(ep);
+      boost::asio::write(stream, boost::asio::buffer(serializeHttpRequest("/", body, false)));
+      boost::beast::flat_buffer buffer;
+      http::response<http::string_body> response;
+      http::read(stream, buffer, response);
+      ASSERT_EQ(response.result(), http::status::ok);
+    }
+  });
+
+  auto send_over_persistent_connections = [&](size_t pipeline_depth) {
+    std::unique_ptr<boost::beast::tcp_stream> stream;
+    boost::beast::flat_buffer buffer;
+    size_t sent_over_connection = 0;
+    for (size_t sent = 0; sent < kRequests; sent += pipeline_depth) {
+      // Server closes the connection after max requests per connection
+      if (!stream || sent_over_connection + pipeline_depth > net::HttpServerConfig().max_requests_per_connection) {
+        stream = std::make_unique<boost::beast::tcp_stream>(ioc);
+        stream->connect(ep);
+        buffer.clear();
+        sent_over_connection = 0;
+      }
+      sent_over_connection += pipeline_depth;
+      std::string requests;
+      for (size_t i = 0; i < pipeline_depth; ++i) {
+        requests += serializeHttpRequest("/", body);
+      }
+      boost::asio::write(*stream, boost::asio::buffer(requests));
+      for (size_t i = 0; i < pipeline_depth; ++i) {
+        http::response<http::string_body> response;
+        http::read(*stream, buffer, response);
+        ASSERT_EQ(response.result(), http::status::ok);
+      }
+    }
+  };
+  measure("Keep-alive connection", [&] { send_over_persistent_connections(1); });
+  measure("Keep-alive connection with " + std::to_string(kPipelineDepth) + " pipelined requests",
+          [&] { send_over_persistent_connections(kPipelineDepth); });
+}
+
+struct RandomLogs {
+  static constexpr size_t kAddresses = 50;
+  static constexpr size_t kTopics = 50;
+  std::mt19937 gen{1};
+
+  addr_t address() { return addr_t(std::uniform_int_distribution<size_t>(1, kAddresses)(gen)); }
+  h256 topic() { return h256(std::uniform_int_distribution<size_t>(1, kTopics)(gen)); }
+
+  net::rpc::eth::LogFilter filter() {
+    AddressSet addresses;
+    net::rpc::eth::LogFilter::Topics topics;
+    // Mix of filters by addresses, by topics on different positions and filters that match everything
+    const auto kind = std::uniform_int_distribution<size_t>(0, 9)(gen);
+    if (kind < 5) {
+      for (size_t i = 0; i <= kind % 3; ++i) {
+        addresses.insert(address());
+      }
+    }
+    if (kind >= 3 && kind < 9) {
+      topics[kind % 4].insert(topic());
+      topics[(kind + 1) % 4].insert(topic());
+    }
+    return net::rpc::eth::LogFilter(0, std::nullopt, std::move(addresses), std::move(topics));
+  }
+
+  final_chain::TransactionReceipt receipt(size_t logs_count) {
+    final_chain::TransactionReceipt receipt;
+    for (size_t i = 0; i < logs_count; ++i) {
+      auto& log = receipt.logs.emplace_back();
+      log.address = address();
+      log.topics.resize(std::uniform_int_distribution<size_t>(0, 4)(gen));
+      for (auto& t : log.topics) {
+        t = topic();
+      }
+    }
+    return receipt;
+  }
+};
+
+TEST_F(RPCTest, logs_dispatcher) {
+  using namespace net::rpc::eth;
+  RandomLogs random;
+  std::vector<LogFilter> filters;
+  LogsDispatcher dispatcher;
+  for (size_t id = 0; id < 1000; ++id) {
+    filters.push_back(random.filter());
+    dispatcher.add(id, filters.back());
+  }
+  // Removed filters are not notified anymore
+  for (size_t id = 0; id < filters.size(); id += 7) {
+    EXPECT_TRUE(dispatcher.remove(id));
+  }
+  EXPECT_FALSE(dispatcher.remove(0));
+  EXPECT_EQ(dispatcher.size(), filters.size() - (filters.size() + 6) / 7);
+
+  ExtendedTransactionLocation trx_loc;
+  for (size_t i = 0; i < 20; ++i) {
+    const auto receipt = random.receipt(10);
+    std::vector<std::pair<LogsDispatcher::SubscriberID, size_t>> expected, dispatched;
+    for (size_t log_i = 0; log_i < receipt.logs.size(); ++log_i) {
+      for (size_t id = 0; id < filters.size(); ++id) {
+        if (id % 7 && filters[id].matches(receipt.logs[log_i])) {
+          expected.emplace_back(id, log_i);
+        }
+      }
+    }
+    dispatcher.dispatch(trx_loc, receipt, [&](auto id, auto const& lle) {
+      dispatched.emplace_back(id, lle.position_in_receipt);
+    });
+    std::sort(dispatched.begin(), dispatched.end(),
+              [](auto const& a, auto const& b) { return std::tie(a.second, a.first) < std::tie(b.second, b.first); });
+    std::sort(expected.begin(), expected.end(),
+              [](auto const& a, auto const& b) { return std::tie(a.second, a.first) < std::tie(b.second, b.first); });
+    EXPECT_EQ(dispatched, expected);
+  }
+
+  // Block range of the filter is respected
+  LogsDispatcher range_dispatcher;
+  range_dispatcher.add(1, LogFilter(10, 20, {}, {}));
+  size_t notified = 0;
+  const auto receipt = random.receipt(1);
+  for (EthBlockNumber blk_n : {9, 10, 20, 21}) {
+    trx_loc.blk_n = blk_n;
+    range_dispatcher.dispatch(trx_loc, receipt, [&](auto, auto const&) { ++notified; });
+  }
+  EXPECT_EQ(notified, 2);
+}
+
+TEST_F(RPCTest, ws_logs_subscription) {
+  util::ThreadPool pool(2);
+  const boost::asio::ip::tcp::endpoint ep{boost::asio::ip::address::from_string("127.0.0.1"), 7791};
+  net::WsServerConfig config;
+  config.max_logs_subscriptions = 2;
+  auto server = std::make_shared<net::JsonRpcWsServer>(pool.unsafe_get_io_context(), ep, addr_t(), config);
+  server->run();
+
+  boost::asio::io_context ioc;
+  boost::beast::websocket::stream<boost::beast::tcp_stream> ws(ioc);
+  boost::beast::get_lowest_layer(ws).connect(ep);
+  ws.handshake("127.0.0.1", "/");
+  auto request = [&](const std::string& msg) {
+    ws.write(boost::asio::buffer(msg));
+    boost::beast::flat_buffer buffer;
+    ws.read(buffer);
+    return util::parse_json(boost::beast::buffers_to_string(buffer.data()));
+  };
+  const auto subscribe_res =
+      request(R"({"jsonrpc":"2.0","id":1,"method":"eth_subscribe","params":["logs",{"address":")" +
+              dev::toJS(addr_t(1)) + R"("}]})");
+  const auto subscription = subscribe_res["result"].asString();
+  ASSERT_FALSE(subscription.empty());
+
+  final_chain::BlockHeader header;
+  header.number = 5;
+  const auto trx = std::make_shared<Transaction>(0, 0, 0, 0, dev::bytes(), dev::KeyPair::create().secret());
+  final_chain::TransactionReceipt receipt;
+  receipt.logs.push_back({addr_t(2), {}, {}});
+  receipt.logs.push_back({addr_t(1), {h256(1)}, {}});
+  server->newLogs(header, {trx}, {receipt});
+
+  boost::beast::flat_buffer buffer;
+  ws.read(buffer);
+  const auto notification = util::parse_json(boost::beast::buffers_to_string(buffer.data()));
+  EXPECT_EQ(notification["method"].asString(), "eth_subscription");
+  EXPECT_EQ(notification["params"]["subscription"].asString(), subscription);
+  const auto& log = notification["params"]["result"];
+  EXPECT_EQ(log["address"].asString(), dev::toJS(addr_t(1)));
+  EXPECT_EQ(log["logIndex"].asString(), "0x1");
+  EXPECT_EQ(log["blockNumber"].asString(), "0x5");
+  EXPECT_EQ(log["transactionHash"].asString(), dev::toJS(trx->getHash()));
+
+  const auto unsubscribe_res =
+      request(R"({"jsonrpc":"2.0","id":2,"method":"eth_unsubscribe","params":[")" + subscription + R"("]})");
+  EXPECT_TRUE(unsubscribe_res["result"].asBool());
+  EXPECT_EQ(server->numLogsSubscriptions(), 0);
+
+  // Number of subscriptions of a session is limited
+  const std::string subscribe_all = R"({"jsonrpc":"2.0","id":3,"method":"eth_subscribe","params":["logs",{}]})";
+  EXPECT_FALSE(request(subscribe_all).isMember("error"));
+  EXPECT_FALSE(request(subscribe_all).isMember("error"));
+  EXPECT_TRUE(request(subscribe_all).isMember("error"));
+  EXPECT_EQ(server->numLogsSubscriptions(), 2);
+
+  // Subscriptions are removed once the session is closed
+  ws.close(boost::beast::websocket::close_code::normal);
+  EXPECT_HAPPENS({10s, 100ms}, [&](auto& ctx) { WAIT_EXPECT_EQ(ctx, server->numLogsSubscriptions(), 0) });
+}
+
+TEST_F(RPCTest, DISABLED_logs_dispatcher_performance) {
+  using namespace net::rpc::eth;
+  constexpr size_t kFilters = 50000;
+  constexpr size_t kReceipts = 500;
+  RandomLogs random;
+  std::vector<LogFilter> filters;
+  LogsDispatcher dispatcher;
+  for (size_t id = 0; id < kFilters; ++id) {
+    filters.push_back(random.filter());
+    dispatcher.add(id, filters.back());
+  }
+  std::vector<final_chain::TransactionReceipt> receipts;
+  for (size_t i = 0; i < kReceipts; ++i) {
+    receipts.push_back(random.receipt(4));
+  }
+
+  auto measure = [&](const std::string& name, auto&& match_receipt) {
+    size_t matches = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto const& receipt : receipts) {
+      matches += match_receipt(receipt);
+    }
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << kReceipts << " receipts against " << kFilters << " filters in " << duration
+              << " ms, " << matches << " matches" << std::endl;
+  };
+  const ExtendedTransactionLocation trx_loc;
+  measure("Every filter", [&](auto const& receipt) {
+    size_t matches = 0;
+    for (auto const& filter : filters) {
+      filter.match_one(trx_loc, receipt, [&](auto const&) { ++matches; });
+    }
+    return matches;
+  });
+  measure("Dispatcher", [&](auto const& receipt) {
+    size_t matches = 0;
+    dispatcher.dispatch(trx_loc, receipt, [&](auto, auto const&) { ++matches; });
+    return matches;
+  });
+}
+
+TEST_F(RPCTest, subscription_event_message) {
+  final_chain::BlockHeader header;
+  header.number = 7;
+  size_t serializations = 0;
+  const net::SubscriptionEvent event([&] {
+    ++serializations;
+    return net::rpc::eth::toJson(header);
+  });
+  for (int subscription_id : {1, 2, 255}) {
+    Json::Value expected, params;
+    expected["jsonrpc"] = "2.0";
+    expected["method"] = "eth_subscription";
+    params["result"] = net::rpc::eth::toJson(header);
+    params["subscription"] = dev::toJS(subscription_id);
+    expected["params"] = params;
+    const auto message = event.message(subscription_id);
+    EXPECT_EQ(message.toString(), util::to_string(expected));
+  }
+  // Body is serialized once and shared by messages of all the subscriptions
+  EXPECT_EQ(serializations, 1);
+  EXPECT_EQ(event.message(1).body, event.message(2).body);
+}
+
+TEST_F(RPCTest, ws_slow_consumer) {
+  using Policy = net::WsServerConfig::SlowConsumerPolicy;
+  constexpr size_t kEvents = 300;
+  uint16_t port = 7793;
+  for (auto policy : {Policy::DropOldest, Policy::Coalesce, Policy::Disconnect}) {
+    net::WsServerConfig config;
+    config.max_queue_messages = 10;
+    config.max_queue_bytes = 1024 * 1024;
+    config.slow_consumer_policy = policy;
+    util::ThreadPool pool(2);
+    const boost::asio::ip::tcp::endpoint ep{boost::asio::ip::address::from_string("127.0.0.1"), port++};
+    auto server = std::make_shared<net::JsonRpcWsServer>(pool.unsafe_get_io_context(), ep, addr_t(), config);
+    server->run();
+
+    boost::asio::io_context ioc;
+    boost::beast::websocket::stream<boost::beast::tcp_stream> ws(ioc);
+    boost::beast::get_lowest_layer(ws).connect(ep);
+    ws.handshake("127.0.0.1", "/");
+    ws.write(boost::asio::buffer(std::string(R"({"jsonrpc":"2.0","id":1,"method":"eth_subscribe",)"
+                                             R"("params":["newHeads"]})")));
+    boost::beast::flat_buffer buffer;
+    ws.read(buffer);
+    ws.write(boost::asio::buffer(std::string(R"({"jsonrpc":"2.0","id":2,"method":"eth_subscribe",)"
+                                             R"("params":["logs",{}]})")));
+    buffer.clear();
+    ws.read(buffer);
+    EXPECT_EQ(server->numLogsSubscriptions(), 1);
+
+    // Client does not read, so big messages fill socket buffers and then the session queue
+    final_chain::BlockHeader header;
+    header.extra_data = dev::bytes(64 * 1024, 1);
+    for (size_t i = 0; i < kEvents; ++i) {
+      header.number = i;
+      server->newEthBlock(header);
+    }
+    const auto& stats = server->queueStats();
+    if (policy == Policy::Disconnect) {
+      EXPECT_HAPPENS({10s, 100ms}, [&](auto& ctx) { WAIT_EXPECT_EQ(ctx, stats->disconnected_sessions.load(), 1) });
+      EXPECT_EQ(stats->dropped_messages, 0);
+      // Logs subscriptions of the disconnected session are removed right away
+      EXPECT_EQ(server->numLogsSubscriptions(), 0);
+    } else {
+      // Limits can be exceeded by one message only until the policy is applied
+      EXPECT_HAPPENS({10s, 100ms}, [&](auto& ctx) {
+        WAIT_EXPECT_GT(ctx, stats->dropped_messages.load(), 0)
+        WAIT_EXPECT_TRUE(ctx, (stats->queued_messages <= config.max_queue_messages))
+        WAIT_EXPECT_TRUE(ctx, (stats->queued_bytes <= config.max_queue_bytes))
+      });
+      EXPECT_EQ(stats->disconnected_sessions, 0);
+
+      // Oldest messages are dropped, so the last one is always delivered
+      Json::Value last;
+      do {
+        buffer.clear();
+        ws.read(buffer);
+        last = util::parse_json(boost::beast::buffers_to_string(buffer.data()));
+      } while (last["params"]["result"]["number"].asString() != dev::toJS(kEvents - 1));
+    }
+  }
+}
+
+TEST_F(RPCTest, DISABLED_ws_subscriptions_fan_out_performance) {
+  constexpr size_t kSubscribers = 500;
+  constexpr size_t kEvents = 100;
+  util::ThreadPool pool(4);
+  const boost::asio::ip::tcp::endpoint ep{boost::asio::ip::address::from_string("127.0.0.1"), 7792};
+  auto server = std::make_shared<net::JsonRpcWsServer>(pool.unsafe_get_io_context(), ep, addr_t());
+  server->run();
+
+  boost::asio::io_context ioc;
+  using WsStream = boost::beast::websocket::stream<boost::beast::tcp_stream>;
+  const std::string subscribe_request = R"({"jsonrpc":"2.0","id":1,"method":"eth_subscribe","params":["newHeads"]})";
+  std::vector<std::unique_ptr<WsStream>> subscribers;
+  for (size_t i = 0; i < kSubscribers; ++i) {
+    auto& ws = subscribers.emplace_back(std::make_unique<WsStream>(ioc));
+    boost::beast::get_lowest_layer(*ws).connect(ep);
+    ws->handshake("127.0.0.1", "/");
+    ws->write(boost::asio::buffer(subscribe_request));
+    boost::beast::flat_buffer buffer;
+    ws->read(buffer);
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  final_chain::BlockHeader header;
+  header.extra_data = dev::bytes(32, 1);
+  for (size_t i = 0; i < kEvents; ++i) {
+    header.number = i;
+    server->newEthBlock(header);
+  }
+  const auto emitted = std::chrono::steady_clock::now();
+  for (auto& ws : subscribers) {
+    for (size_t i = 0; i < kEvents; ++i) {
+      boost::beast::flat_buffer buffer;
+      ws->read(buffer);
+    }
+  }
+  const auto delivered = std::chrono::steady_clock::now();
+  auto ms = [](auto duration) { return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count(); };
+  std::cout << kEvents << " events to " << kSubscribers << " subscribers: emitted in " << ms(emitted - start)
+            << " ms, delivered in " << ms(delivered - start) << " ms" << std::endl;
+  for (auto& ws : subscribers) {
+    ws->close(boost::beast::websocket::close_code::normal);
+  }
+}
+
 }  // namespace taraxa::core_tests
 
 using namespace taraxa;
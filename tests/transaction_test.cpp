@@ -215,7 +215,8 @@ TEST_F(TransactionTest, transaction_low_nonce) {
   db->saveTransactionPeriod(trx_2->getHash(), 1, 0);
   db->savePeriodData(period_data, batch);
   db->commitWriteBatch(batch);
-  final_chain->finalize(std::move(period_data), {dag_blk.getHash()}).get();
+  const auto finalization_result = final_chain->finalize(std::move(period_data), {dag_blk.getHash()}).get();
+  trx_mgr.updateLatestAccounts(*finalization_result);
 
   // Verify low nonce transaction is detected in verification
   auto low_nonce_trx = std::make_shared<Transaction>(1, 101, 0, 100000, dev::bytes(), g_secret, addr_t::random());
@@ -254,6 +255,64 @@ TEST_F(TransactionTest, transaction_low_nonce) {
   EXPECT_FALSE(trx_mgr.getBlockTransactions(dag_blk_with_insufficient_balance_transaction).has_value());
 }
 
+TEST_F(TransactionTest, latest_accounts_update) {
+  auto db = std::make_shared<DbStorage>(data_dir);
+  auto cfg = node_cfgs.front();
+  auto final_chain = NewFinalChain(db, cfg);
+  TransactionManager trx_mgr(cfg, db, final_chain, addr_t());
+  const auto receiver = dev::KeyPair::create();
+  const auto sender_balance = final_chain->get_account(dev::toAddress(g_secret))->balance;
+
+  // Sender and receiver accounts are cached by inserting and verifying their transactions
+  auto trx_1 = std::make_shared<Transaction>(1, 100, 0, 100000, dev::bytes(), g_secret, receiver.address());
+  auto trx_2 = std::make_shared<Transaction>(2, 100, 0, 100000, dev::bytes(), g_secret, receiver.address());
+  EXPECT_TRUE(trx_mgr.insertTransaction(trx_1).first);
+  EXPECT_TRUE(trx_mgr.insertTransaction(trx_2).first);
+  auto stale_nonce_trx = std::make_shared<Transaction>(1, 101, 0, 100000, dev::bytes(), g_secret, addr_t::random());
+  EXPECT_EQ(trx_mgr.verifyTransaction(stale_nonce_trx).first, TransactionStatus::Verified);
+  auto stale_balance_trx =
+      std::make_shared<Transaction>(3, sender_balance - 199, 0, 100000, dev::bytes(), g_secret, addr_t::random());
+  EXPECT_EQ(trx_mgr.verifyTransaction(stale_balance_trx).first, TransactionStatus::Verified);
+  auto receiver_trx =
+      std::make_shared<Transaction>(1, 200, 0, 100000, dev::bytes(), receiver.secret(), addr_t::random());
+  EXPECT_EQ(trx_mgr.verifyTransaction(receiver_trx).first, TransactionStatus::InsufficentBalance);
+
+  // Execute transactions that change nonce and balance of both accounts
+  DagBlock dag_blk({}, {}, {}, {trx_1->getHash(), trx_2->getHash()}, secret_t::random());
+  db->saveDagBlock(dag_blk);
+  std::vector<vote_hash_t> reward_votes_hashes;
+  auto pbft_block =
+      std::make_shared<PbftBlock>(kNullBlockHash, kNullBlockHash, kNullBlockHash, kNullBlockHash, 1, addr_t::random(),
+                                  dev::KeyPair::create().secret(), std::move(reward_votes_hashes));
+  PeriodData period_data(pbft_block, {});
+  period_data.dag_blocks.push_back(dag_blk);
+  period_data.transactions = {trx_1, trx_2};
+  auto batch = db->createWriteBatch();
+  db->saveTransactionPeriod(trx_1->getHash(), 1, 0);
+  db->saveTransactionPeriod(trx_2->getHash(), 1, 0);
+  db->savePeriodData(period_data, batch);
+  db->commitWriteBatch(batch);
+  const auto finalization_result = final_chain->finalize(std::move(period_data), {dag_blk.getHash()}).get();
+  trx_mgr.updateLatestAccounts(*finalization_result);
+
+  // Cached sender nonce is updated, so the already executed nonce is not eligible for the pool anymore
+  EXPECT_EQ(trx_mgr.verifyTransaction(stale_nonce_trx).first, TransactionStatus::LowNonce);
+  EXPECT_FALSE(trx_mgr.insertTransaction(stale_nonce_trx).first);
+
+  // Cached sender balance is lowered, a stale cache would still accept this transaction
+  EXPECT_EQ(final_chain->get_account(dev::toAddress(g_secret))->balance, sender_balance - 200);
+  EXPECT_EQ(trx_mgr.verifyTransaction(stale_balance_trx).first, TransactionStatus::InsufficentBalance);
+  EXPECT_FALSE(trx_mgr.insertTransaction(stale_balance_trx).first);
+  auto next_nonce_trx =
+      std::make_shared<Transaction>(3, sender_balance - 200, 0, 100000, dev::bytes(), g_secret, addr_t::random());
+  EXPECT_EQ(trx_mgr.verifyTransaction(next_nonce_trx).first, TransactionStatus::Verified);
+  EXPECT_TRUE(trx_mgr.insertTransaction(next_nonce_trx).first);
+
+  // Cached receiver balance is raised, its transaction becomes eligible for the pool
+  EXPECT_EQ(trx_mgr.verifyTransaction(receiver_trx).first, TransactionStatus::Verified);
+  EXPECT_TRUE(trx_mgr.insertTransaction(receiver_trx).first);
+}
+
 TEST_F(TransactionTest, transaction_concurrency) {
   auto db = std::make_shared<DbStorage>(data_dir);
   auto cfg = node_cfgs.front();
@@ -281,6 +340,8 @@ TEST_F(TransactionTest, transaction_concurrency) {
     db->saveTransactionPeriod(g_signed_trx_samples[i]->getHash(), 1, i);
     PeriodData period_data;
     period_data.transactions = {g_signed_trx_samples[i]};
+    // Lock the same way as pbft block finalization does
+    std::unique_lock trx_lock(trx_mgr.getTransactionsMutex());
     trx_mgr.updateFinalizedTransactionsStatus(period_data);
   }
 
@@ -314,6 +375,31 @@ TEST_F(TransactionTest, transaction_concurrency) {
   }
 }
 
+TEST_F(TransactionTest, concurrent_transactions_count) {
+  auto db = std::make_shared<DbStorage>(data_dir);
+  auto cfg = node_cfgs.front();
+  TransactionManager trx_mgr(cfg, db, NewFinalChain(db, cfg), addr_t());
+  for (auto const& t : *g_signed_trx_samples) {
+    trx_mgr.insertTransaction(t);
+  }
+
+  // Transactions of dag blocks are saved concurrently, stored count must not be overwritten by an older one
+  constexpr size_t kThreads = 4;
+  std::vector<std::thread> threads;
+  for (size_t thread = 0; thread < kThreads; ++thread) {
+    threads.emplace_back([&, thread] {
+      for (size_t i = thread; i < g_signed_trx_samples->size(); i += kThreads) {
+        trx_mgr.saveTransactionsFromDagBlock({g_signed_trx_samples[i]});
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  EXPECT_EQ(trx_mgr.getTransactionCount(), g_signed_trx_samples->size());
+  EXPECT_EQ(db->getStatusField(StatusDbField::TrxCount), g_signed_trx_samples->size());
+}
+
 TEST_F(TransactionTest, priority_queue) {
   // Check ordering by same sender and different nonce
   {
@@ -637,6 +723,175 @@ TEST_F(TransactionTest, priority_queue_ordering_eth_test) {
   }
 }
 
+// Reference ordering which sorts all the accounts head transactions on every call
+SharedTransactions referenceOrderedTransactions(const SharedTransactions& trxs) {
+  std::unordered_map<addr_t, std::map<val_t, std::shared_ptr<Transaction>>> account_nonce_transactions;
+  for (const auto& t : trxs) {
+    account_nonce_transactions[t->getSender()][t->getNonce()] = t;
+  }
+  std::map<std::pair<val_t, trx_hash_t>, std::shared_ptr<Transaction>, std::greater<std::pair<val_t, trx_hash_t>>>
+      head_transactions;
+  for (const auto& account : account_nonce_transactions) {
+    const auto& t = account.second.begin()->second;
+    head_transactions.emplace(std::make_pair(t->getGasPrice(), t->getHash()), t);
+  }
+  SharedTransactions ret;
+  while (!head_transactions.empty()) {
+    const auto t = head_transactions.begin()->second;
+    head_transactions.erase(head_transactions.begin());
+    ret.push_back(t);
+    const auto& account = account_nonce_transactions[t->getSender()];
+    if (const auto next = account.upper_bound(t->getNonce()); next != account.end()) {
+      head_transactions.emplace(std::make_pair(next->second->getGasPrice(), next->second->getHash()), next->second);
+    }
+  }
+  return ret;
+}
+
+TEST_F(TransactionTest, priority_queue_ordering_reference) {
+  const uint32_t number_of_runs = 10;
+  for (uint32_t i = 0; i < number_of_runs; i++) {
+    const uint32_t max_queue_size = 1000;
+    TransactionQueue priority_queue(max_queue_size);
+    auto trxs = generateRandomOrderTransactions(max_queue_size);
+    for (auto t : trxs) {
+      priority_queue.insert(std::move(t), TransactionStatus::Verified, 1);
+    }
+    // Remove some transactions to check that the index is properly maintained on erase
+    for (uint32_t j = 0; j < trxs.size(); j += 7) {
+      priority_queue.erase(trxs[j]->getHash());
+    }
+
+    const auto expected = referenceOrderedTransactions(priority_queue.getAllTransactions());
+    const auto ordered_trxs = priority_queue.getOrderedTransactions(max_queue_size);
+    ASSERT_EQ(ordered_trxs.size(), expected.size());
+    for (uint32_t j = 0; j < expected.size(); j++) {
+      EXPECT_EQ(ordered_trxs[j]->getHash(), expected[j]->getHash());
+    }
+
+    // Partial ordering must be a prefix of the full ordering
+    const auto partial_trxs = priority_queue.getOrderedTransactions(expected.size() / 3);
+    ASSERT_EQ(partial_trxs.size(), expected.size() / 3);
+    for (uint32_t j = 0; j < partial_trxs.size(); j++) {
+      EXPECT_EQ(partial_trxs[j]->getHash(), expected[j]->getHash());
+    }
+  }
+}
+
+TEST_F(TransactionTest, sharded_pool_ordering_reference) {
+  auto db = std::make_shared<DbStorage>(data_dir);
+  auto cfg = node_cfgs.front();
+  TransactionManager trx_mgr(cfg, db, NewFinalChain(db, cfg), addr_t());
+  const uint32_t trxs_count = 1000;
+  for (auto t : generateRandomOrderTransactions(trxs_count)) {
+    trx_mgr.insertValidatedTransaction(std::move(t), TransactionStatus::Verified);
+  }
+
+  // Transactions of all pool shards must be ordered the same way as if they were in a single queue
+  const auto expected = referenceOrderedTransactions(trx_mgr.getAllPoolTrxs());
+  const auto [packed_trxs, estimations] = trx_mgr.packTrxs(1, trxs_count * 100000);
+  ASSERT_EQ(packed_trxs.size(), expected.size());
+  for (uint32_t j = 0; j < expected.size(); j++) {
+    EXPECT_EQ(packed_trxs[j]->getHash(), expected[j]->getHash());
+  }
+}
+
+TEST_F(TransactionTest, sharded_pool_limits) {
+  auto db = std::make_shared<DbStorage>(data_dir);
+  auto cfg = node_cfgs.front();
+  cfg.transactions_pool_size = 100;
+  TransactionManager trx_mgr(cfg, db, NewFinalChain(db, cfg), addr_t());
+
+  // All transactions of one sender are in a single shard, the shard can use whole capacity of the pool
+  const auto sender = secret_t::random();
+  for (uint32_t i = 0; i < cfg.transactions_pool_size; i++) {
+    EXPECT_TRUE(trx_mgr.insertValidatedTransaction(
+        std::make_shared<Transaction>(i, 1, 20, 100, dev::bytes(), sender, addr_t::random()),
+        TransactionStatus::Verified));
+  }
+  EXPECT_EQ(trx_mgr.getTransactionPoolSize(), cfg.transactions_pool_size);
+  EXPECT_FALSE(trx_mgr.transactionsDropped());
+
+  // Lowest gas price transaction of the whole pool is evicted, no matter which shard it is in
+  auto lowest = std::make_shared<Transaction>(0, 1, 10, 100, dev::bytes(), secret_t::random(), addr_t::random());
+  const auto lowest_hash = lowest->getHash();
+  EXPECT_FALSE(trx_mgr.insertValidatedTransaction(std::move(lowest), TransactionStatus::Verified));
+  EXPECT_EQ(trx_mgr.getTransactionPoolSize(), cfg.transactions_pool_size);
+  EXPECT_FALSE(trx_mgr.getTransaction(lowest_hash));
+  EXPECT_TRUE(trx_mgr.transactionsDropped());
+
+  // Non proposable transactions are limited pool wide
+  const size_t non_proposable_max =
+      cfg.transactions_pool_size * TransactionQueue::kNonProposableTransactionsLimitPercentage / 100;
+  size_t inserted = 0;
+  for (size_t i = 0; i < non_proposable_max * 2; i++) {
+    inserted += trx_mgr.insertValidatedTransaction(
+        std::make_shared<Transaction>(0, 1, 20, 100, dev::bytes(), secret_t::random(), addr_t::random()),
+        TransactionStatus::LowNonce);
+    EXPECT_EQ(trx_mgr.nonProposableTransactionsOverTheLimit(), inserted >= non_proposable_max);
+  }
+  EXPECT_EQ(inserted, non_proposable_max + 1);
+}
+
+TEST_F(TransactionTest, priority_queue_eviction) {
+  // Every transaction is from a different account so the lowest gas price transaction is evicted on overflow
+  const uint32_t max_queue_size = 100;
+  TransactionQueue priority_queue(max_queue_size);
+  SharedTransactions trxs;
+  for (uint32_t i = 0; i <= max_queue_size; i++) {
+    trxs.emplace_back(std::make_shared<Transaction>(0, 1, 10 + i, 100, dev::bytes(), secret_t::random(),
+                                                    addr_t::random()));
+  }
+  const auto lowest_gas_price_hash = trxs[0]->getHash();
+  std::shuffle(trxs.begin(), trxs.end(), std::mt19937(std::random_device()()));
+  for (auto& t : trxs) {
+    priority_queue.insert(std::move(t), TransactionStatus::Verified, 1);
+  }
+  EXPECT_EQ(priority_queue.size(), max_queue_size);
+  EXPECT_FALSE(priority_queue.contains(lowest_gas_price_hash));
+  EXPECT_FALSE(priority_queue.isTransactionKnown(lowest_gas_price_hash));
+}
+
+TEST_F(TransactionTest, DISABLED_priority_queue_performance) {
+  std::vector<secret_t> secrets;
+  for (uint32_t i = 0; i < 1000; i++) {
+    secrets.push_back(secret_t::random());
+  }
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<uint32_t> gas_price_dist(1, 1000000);
+  for (const uint32_t pool_size : {10000, 100000, 1000000}) {
+    TransactionQueue priority_queue(pool_size);
+    for (uint32_t i = 0; i < pool_size; i++) {
+      auto trx = std::make_shared<Transaction>(i / secrets.size(), 1, gas_price_dist(rng), 100, dev::bytes(),
+                                               secrets[i % secrets.size()], addr_t::random());
+      trx->getSender();
+      priority_queue.insert(std::move(trx), TransactionStatus::Verified, 1);
+    }
+
+    const uint32_t iterations = 100;
+    const uint32_t trxs_to_pack = 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+      priority_queue.getOrderedTransactions(trxs_to_pack);
+    }
+    const auto ordering_time =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start) / iterations;
+
+    // Pool is full so inserts periodically evict 1% of the pool
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+      priority_queue.insert(std::make_shared<Transaction>(0, 1, gas_price_dist(rng), 100, dev::bytes(),
+                                                          secret_t::random(), addr_t::random()),
+                            TransactionStatus::Verified, 1);
+    }
+    const auto eviction_time =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start) / iterations;
+
+    std::cout << "Pool size " << pool_size << ": getOrderedTransactions(" << trxs_to_pack << ") "
+              << ordering_time.count() << "us, insert into full pool " << eviction_time.count() << "us" << std::endl;
+  }
+}
+
 TEST_F(TransactionTest, typed_deserialization) {
   auto trx_rlp =
       "0x01f88380018203339407a565b7ed7d7a678680a4c162885bedbb695fe080a44401a6e40000000000000000000000000000000000000000"